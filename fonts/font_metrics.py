@@ -0,0 +1,136 @@
+# Font metrics generator for esp32-weather-epd.
+# Copyright (C) 2022-2023  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Reads the glyph tables of the GFXfont headers of a font family under
+# platformio/include/fonts and writes platformio/include/fonts/<FONT>_metrics.h,
+# with the advance and bounding box of each glyph as constexpr tables. So text
+# in a constant string can be measured when compiling, see
+# platformio/include/font_metrics.h.
+#
+# The family is the one FONT_HEADER selects in platformio/include/config.h,
+# unless another is given with -f. The metrics headers are not kept in the
+# repository, platformio/scripts/font_metrics.py runs this when building. With
+# -c it only checks that the metrics are up to date, the exit status is 1 if
+# they are not.
+
+import getopt
+import os.path
+import re
+import sys
+
+FONTS_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                          '..', 'platformio', 'include', 'fonts')
+CONFIG = os.path.join(FONTS_PATH, '..', 'config.h')
+
+GLYPHS = re.compile(r'const GFXglyph (\w+)Glyphs\[\] PROGMEM = \{(.*?)\};',
+                    re.S)
+GLYPH = re.compile(r'\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),'
+                   r'\s*(-?\d+)\s*\}')
+NUMBER = r'(0x[0-9A-Fa-f]+|\d+)'
+FONT = re.compile(r'const GFXfont (\w+) PROGMEM = \{[^}]*?'
+                  + NUMBER + r',\s*' + NUMBER + r',\s*(\d+)\s*\};')
+FONT_NAME = re.compile(r'_(\d+)pt8b(\w*)$')
+FONT_HEADER = re.compile(r'^#define FONT_HEADER "fonts/(\w+)\.h"', re.M)
+
+def usage():
+    print('font_metrics.py [-c] [-f <family>]')
+
+check = False
+family = None
+try:
+    opts, args = getopt.getopt(sys.argv[1:], "hcf:", ["check", "family="])
+except getopt.GetoptError:
+    usage()
+    sys.exit(2)
+for opt, arg in opts:
+    if opt == '-h':
+        usage()
+        sys.exit()
+    elif opt in ("-c", "--check"):
+        check = True
+    elif opt in ("-f", "--family"):
+        family = arg
+
+if family is None:
+    with open(CONFIG) as f:
+        m = FONT_HEADER.search(f.read())
+    if m is None:
+        sys.exit(CONFIG + ': no FONT_HEADER')
+    family = m.group(1)
+if not os.path.isdir(os.path.join(FONTS_PATH, family)):
+    sys.exit('no font family ' + family + ' in ' + FONTS_PATH)
+
+# the metrics of one font, from its header
+def font_metrics(path):
+    with open(path, encoding='latin-1') as f:
+        text = f.read()
+    name, body = GLYPHS.search(text).groups()
+    m = FONT.search(text)
+    first, last, y_advance = int(m.group(2), 0), int(m.group(3), 0), \
+                             int(m.group(4))
+    out = 'constexpr font_glyph_metrics_t ' + name + 'GlyphMetrics[] = {\n'
+    rows = []
+    for c, g in enumerate(GLYPH.finditer(body), first):
+        width, height, x_advance, x_offset, y_offset = \
+            (int(v) for v in g.groups()[1:])
+        # xAdvance, left, right, top, bottom, inclusive
+        row = (x_advance, x_offset, x_offset + width - 1, y_offset,
+               y_offset + height - 1)
+        if not all(-128 <= v <= 127 for v in row[1:]):
+            sys.exit(path + ': glyph 0x{:02X} does not fit int8_t'.format(c))
+        char = " '" + chr(c) + "'" if 0x20 <= c < 0x7F else ''
+        rows.append(('  {{ {:3d}, {:4d}, {:4d}, {:4d}, {:4d} }}'.format(*row),
+                     '// 0x{:02X}{}'.format(c, char)))
+    if len(rows) != last - first + 1:
+        sys.exit(path + ': expected ' + str(last - first + 1) + ' glyphs')
+    out += ''.join(r + (', ' if i < len(rows) - 1 else ' ') + comment + '\n'
+                   for i, (r, comment) in enumerate(rows))
+    out += ('};\n'
+            'constexpr font_metrics_t ' + m.group(1) + '_metrics = {\n'
+            '  ' + name + 'GlyphMetrics,\n'
+            '  0x{:02X}, 0x{:02X}, {} }};\n'.format(first, last, y_advance))
+    return m.group(1), out
+
+guard = '__FONTS_' + family.upper() + '_METRICS_H__'
+header = ('// Metrics of the ' + family + ' fonts, generated by\n'
+          '// fonts/font_metrics.py. See font_metrics.h.\n'
+          '#ifndef ' + guard + '\n'
+          '#define ' + guard + '\n'
+          '\n'
+          '#include "font_metrics.h"\n')
+defines = ''
+for f in sorted(os.listdir(os.path.join(FONTS_PATH, family))):
+    name, metrics = font_metrics(os.path.join(FONTS_PATH, family, f))
+    size, suffix = FONT_NAME.search(name).groups()
+    header += '\n' + metrics
+    defines += ('#define FONT_' + size + 'pt8b' + suffix + '_metrics '
+                + name + '_metrics\n')
+header += '\n' + defines + '#endif\n'
+
+path = os.path.join(FONTS_PATH, family + '_metrics.h')
+old = None
+if os.path.exists(path):
+    with open(path, 'rb') as f:
+        old = f.read()
+if old == header.encode():
+    print(family + ' metrics are up to date')
+    sys.exit()
+if check:
+    print(os.path.relpath(path) + ' is out of date, run font_metrics.py')
+    sys.exit(1)
+with open(path, 'wb') as f:
+    f.write(header.encode())
+print(family + ' metrics written to ' + os.path.relpath(path))
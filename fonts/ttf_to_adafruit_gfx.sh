@@ -96,6 +96,7 @@ for fontfile in $TTF_FILES
     do
     echo "#include \"$FONT/`basename $FILE`\"" >> $HEADER_FILE
   done
+  echo "#include \"${FONT}_metrics.h\"" >> $HEADER_FILE
   echo "" >> $HEADER_FILE
   for FILE in $OUTPUT_PATH/$FONT/*
     do
@@ -0,0 +1,216 @@
+# Icon registry generator for esp32-weather-epd.
+# Copyright (C) 2022-2023  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Finds the icons the firmware uses, by their IDs (ICON_<NAME>), and writes:
+#   platformio/include/icons/icons.h  the icon IDs
+#   platformio/src/icons.cpp          the only translation unit that includes
+#                                     the icons' headers, when they are
+#                                     compiled in
+#   platformio/src/icon_paths.cpp     the vector icons, converted from the
+#                                     icons' svgs by svg_path.py
+# So each used icon is compiled once, and the thousands of others not at all.
+# With -p <file> it only writes the icon pack, for the icons partition when
+# ICON_PACK is defined, to file. The icon pack is not kept in the repository,
+# platformio/scripts/icon_pack.py writes it to platformio/icons.bin when
+# building.
+# The icon pack format is described in platformio/include/icon_pack.h, the
+# vector icon format in platformio/include/vector_icon.h.
+#
+# Run it again after using an icon that is not in icons.h yet. With -c it only
+# checks that the registry is up to date, the exit status is 1 if it is not.
+
+import getopt
+import os.path
+import re
+import struct
+import sys
+import zlib
+
+import svg_path
+
+PLATFORMIO = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                          '..', 'platformio')
+SOURCES = ['src/main.cpp', 'src/display_utils.cpp', 'src/renderer.cpp',
+           'src/wake_tasks.cpp']
+ICONS_PATH = 'include/icons'
+HEADER = 'include/icons/icons.h'
+SOURCE = 'src/icons.cpp'
+PATHS_SOURCE = 'src/icon_paths.cpp'
+SVG_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'svg')
+
+# see icon_pack.h
+PACK_MAGIC = b'ICNP'
+PACK_VERSION = 1
+PACK_ALIGN = 4
+PACK_HEADER = '<4sHHII'
+PACK_ENTRY = '<IIHH'
+
+ICON_ID = re.compile(r'\bICON_([A-Z0-9_]+_(\d+)X\2)\b')
+ICON_SIZE = re.compile(r'^// (\d+) x (\d+)')
+ICON_BYTE = re.compile(r'0x([0-9a-fA-F]{2})')
+ICON_SUFFIX = re.compile(r'\d+x\d+$')
+BYTES_PER_LINE = 12
+
+def usage():
+    print('icon_registry.py [-c] [-p <icons.bin>]')
+
+check = False
+pack_path = None
+try:
+    opts, args = getopt.getopt(sys.argv[1:], "hcp:", ["check", "pack="])
+except getopt.GetoptError:
+    usage()
+    sys.exit(2)
+for opt, arg in opts:
+    if opt == '-h':
+        usage()
+        sys.exit()
+    elif opt in ("-c", "--check"):
+        check = True
+    elif opt in ("-p", "--pack"):
+        pack_path = arg
+
+# every ID that has a header is used, whichever configuration it is under
+icons = {}
+for src in SOURCES:
+    with open(os.path.join(PLATFORMIO, src)) as f:
+        for m in ICON_ID.finditer(f.read()):
+            name = m.group(1).lower()
+            size = m.group(2) + 'x' + m.group(2)
+            header = size + '/' + name + '.h'
+            if os.path.exists(os.path.join(PLATFORMIO, ICONS_PATH, header)):
+                icons[name] = header
+
+# by size, then name
+order = sorted(icons, key=lambda n: (int(icons[n].split('x')[0]), n))
+# identifies the list of IDs, so that a pack built from another is rejected
+registry_id = zlib.crc32('\n'.join(order).encode())
+
+header = ('// Icons used by the firmware, generated by icons/icon_registry.py.\n'
+          '#ifndef __ICONS_H__\n'
+          '#define __ICONS_H__\n'
+          '\n'
+          '#include <cstdint>\n'
+          '\n'
+          '// Identifies this list of icons, the icon pack must be built from it.\n'
+          '#define ICON_REGISTRY_ID 0x{:08x}\n'.format(registry_id) +
+          '\n'
+          'typedef enum icon_id\n'
+          '{\n')
+for name in order:
+    header += '  ICON_' + name.upper() + ',\n'
+header += ('  ICON_COUNT\n'
+           '} icon_id_t;\n'
+           '\n'
+           '// The icons compiled in, by ID, see src/icons.cpp.\n'
+           'extern const uint8_t *const iconData[ICON_COUNT];\n'
+           '// The vector icons, by ID, see src/icon_paths.cpp.\n'
+           'extern const uint8_t *const iconPaths[ICON_COUNT];\n'
+           '\n'
+           '#endif\n')
+
+source = ('// Icons used by the firmware, generated by icons/icon_registry.py.\n'
+          '// When ICON_PACK is defined they are read from the icon pack\n'
+          '// instead.\n'
+          '#include <Arduino.h>\n'
+          '#include "config.h"\n'
+          '#include "icons/icons.h"\n'
+          '\n'
+          '#ifndef ICON_PACK\n')
+for name in order:
+    source += '#include "icons/' + icons[name] + '"\n'
+source += '\nconst uint8_t *const iconData[ICON_COUNT] = {\n'
+source += ',\n'.join('  ' + name for name in order)
+source += '};\n#endif\n'
+
+# one vector icon for each svg, whichever sizes its icons are, named as
+# svg_to_headers.sh names their headers
+svgs = {}
+for f in os.listdir(SVG_PATH):
+    if f.endswith('.svg'):
+        svgs[re.sub(r'[^A-Za-z0-9]+', '_', f[:-len('.svg')] + '\n')] = f
+paths = {}
+for name in order:
+    base = ICON_SUFFIX.sub('', name)
+    if base not in paths:
+        with open(os.path.join(SVG_PATH, svgs[base])) as f:
+            paths[base] = svg_path.tokenize(f.read())
+paths_source = ('// Vector icons used by the firmware, generated by\n'
+                '// icons/icon_registry.py. See vector_icon.h.\n'
+                '#include <Arduino.h>\n'
+                '#include "icons/icons.h"\n')
+for base in sorted(paths):
+    data = paths[base]
+    paths_source += ('\n// ' + svgs[base] + ', ' + str(len(data)) + ' bytes\n'
+                     'static const uint8_t ' + base + 'path[] PROGMEM = {\n')
+    lines = []
+    for i in range(0, len(data), BYTES_PER_LINE):
+        lines.append('  ' + ', '.join('0x{:02x}'.format(b) for b in
+                                      data[i:i + BYTES_PER_LINE]))
+    paths_source += ',\n'.join(lines) + '\n};\n'
+paths_source += '\nconst uint8_t *const iconPaths[ICON_COUNT] = {\n'
+paths_source += ',\n'.join('  ' + ICON_SUFFIX.sub('', name) + 'path'
+                           for name in order)
+paths_source += '};\n'
+
+# the index, then the payloads, each aligned
+index_len = (struct.calcsize(PACK_HEADER)
+             + len(order) * struct.calcsize(PACK_ENTRY))
+entries = b''
+payloads = b''
+offset = index_len
+for name in order:
+    with open(os.path.join(PLATFORMIO, ICONS_PATH, icons[name])) as f:
+        text = f.read()
+    width, height = ICON_SIZE.match(text).groups()
+    body = text[text.index('{') + 1:text.rindex('}')]
+    payload = bytes(int(b, 16) for b in ICON_BYTE.findall(body))
+    entries += struct.pack(PACK_ENTRY, offset, len(payload), int(width),
+                           int(height))
+    payload += b'\0' * (-len(payload) % PACK_ALIGN)
+    payloads += payload
+    offset += len(payload)
+pack = struct.pack(PACK_HEADER, PACK_MAGIC, PACK_VERSION, len(order),
+                   registry_id, offset) + entries + payloads
+
+if pack_path is not None:
+    with open(pack_path, "wb") as f:
+        f.write(pack)
+    print(str(len(order)) + ' icons, ' + str(len(pack)) + ' byte icon pack')
+    sys.exit()
+
+stale = []
+for path, data in ((HEADER, header.encode()), (SOURCE, source.encode()),
+                   (PATHS_SOURCE, paths_source.encode())):
+    path = os.path.join(PLATFORMIO, path)
+    old = None
+    if os.path.exists(path):
+        with open(path, "rb") as f:
+            old = f.read()
+    if old == data:
+        continue
+    stale.append(os.path.relpath(path))
+    if not check:
+        with open(path, "wb") as f:
+            f.write(data)
+
+if check:
+    for path in stale:
+        print(path + ' is out of date, run icon_registry.py')
+    sys.exit(1 if stale else 0)
+print(str(len(order)) + ' icons registered, ' + str(len(pack))
+      + ' byte icon pack, ' + str(sum(len(p) for p in paths.values()))
+      + ' bytes of vector icons')
@@ -22,6 +22,10 @@ from PIL import Image
 BITES_PER_LINE = 12
 BITS_PER_BITE = 8
 THRESHOLD = 127
+RLE_WHITE = 0x80
+RLE_BLACK = 0xc0
+RLE_MAX_RUN = 64
+RLE_MAX_LITERAL = 128
 
 try:
     opts, args = getopt.getopt(sys.argv[1:],"hi:o:",["inputfile=","outputfile="])
@@ -57,38 +61,61 @@ var = os.path.basename(outputfile)
 var = var.rsplit('.h',1)[0]
 
 width, height = src_image.size
-f.write("// " + str(width) + " x " + str(height) + "\n")
-f.write("const unsigned char " + var + "[] PROGMEM = {\n ")
 
-bit_cnt = 1
-transcribed_width = 1
-tmp_bite = 0
-n = len(pixels)
-line_width = 0
+# Packs the pixels into rows of whole bytes, most significant bit leftmost, 1
+# for white. The bits past the end of each row are white too, so that blank
+# rows form long runs.
+row_bytes = (width + BITS_PER_BITE - 1) // BITS_PER_BITE
+bitmap = bytearray([0xff] * (row_bytes * height))
+for i in range(len(pixels)):
+    if (pixels[i] <= THRESHOLD):
+        y, x = divmod(i, width)
+        bitmap[y * row_bytes + x // BITS_PER_BITE] &= ~(0x80 >> (x % BITS_PER_BITE)) & 0xff
+
+# Run-length encodes the bitmap, as decoded by icon_rle.cpp. Each code byte is
+# followed by its literal bytes, if any:
+#   0nnnnnnn  n + 1 literal bytes follow
+#   10nnnnnn  n + 1 white bytes (0xff)
+#   11nnnnnn  n + 1 black bytes (0x00)
+# Runs and literals may continue onto the next row.
+encoded = bytearray()
+literal = bytearray()
+
+def flush_literal():
+    global literal
+    while literal:
+        chunk = literal[:RLE_MAX_LITERAL]
+        encoded.append(len(chunk) - 1)
+        encoded.extend(chunk)
+        literal = literal[RLE_MAX_LITERAL:]
+
+i = 0
+n = len(bitmap)
+while i < n:
+    b = bitmap[i]
+    if b in (0xff, 0x00):
+        j = i
+        while j < n and bitmap[j] == b and j - i < RLE_MAX_RUN:
+            j += 1
+        # a lone byte is cheaper as part of the literal it interrupts
+        if j - i >= 2 or not literal:
+            flush_literal()
+            encoded.append((RLE_WHITE if b == 0xff else RLE_BLACK) | (j - i - 1))
+            i = j
+            continue
+    literal.append(b)
+    i += 1
+flush_literal()
+
+f.write("// " + str(width) + " x " + str(height) + ", run-length encoded\n")
+f.write("const unsigned char " + var + "[] PROGMEM = {\n ")
 
-for i in range(n):
-    line_width += 1
-    if (pixels[i] > THRESHOLD):
-        tmp_bite |= 1
-    if (line_width == width):
-        tmp_bite <<= BITS_PER_BITE - bit_cnt
-        line_width = 0
-        bit_cnt = 8
-    # if there is still more room in the current byte, shift the bits to make room for the next new bit
-    if (bit_cnt < BITS_PER_BITE and i != n - 1):
-        tmp_bite <<= 1
-        bit_cnt += 1
-    # else byte must be complete, write the byte to file
-    elif (i != n - 1):
-        f.write(" " + "0x{:02x}".format(tmp_bite) + ",")
-        if (transcribed_width == BITES_PER_LINE):
-            f.write("\n ")
-            transcribed_width = 1
-        else:
-            transcribed_width += 1
-        tmp_bite = 0
-        bit_cnt = 1
-        
-tmp_bite <<= BITS_PER_BITE - bit_cnt
-f.write(" " + "0x{:02x}".format(tmp_bite) + "\n};")
+for i in range(len(encoded)):
+    f.write(" " + "0x{:02x}".format(encoded[i]))
+    if (i == len(encoded) - 1):
+        f.write("\n};")
+    elif ((i + 1) % BITES_PER_LINE == 0):
+        f.write(",\n ")
+    else:
+        f.write(",")
 f.close()
\ No newline at end of file
@@ -0,0 +1,384 @@
+# SVG to vector icon path converter for esp32-weather-epd.
+# Copyright (C) 2022-2023  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Converts the filled shapes of an svg to a vector icon path, as drawn by
+# Framebuffer::drawVectorIcon. The format is described in
+# platformio/include/vector_icon.h. Used by icon_registry.py.
+#
+# Supported: <path>, <rect>, <circle>, <ellipse>, <polygon> and <g>, the
+# transform attribute, and the fill and fill-rule properties, as attributes,
+# in style attributes or in classes of a <style> element. Shapes with no fill
+# are skipped, strokes are not drawn.
+
+import math
+import re
+import xml.etree.ElementTree as ET
+
+# see vector_icon.h
+UNITS = 2048
+MOVE = 0x00
+LINE = 0x40
+CUBIC = 0x80
+FILL = 0xC0
+END = 0xFF
+EVEN_ODD = 0x01
+MAX_RUN = 64
+
+# a cubic whose control points are this close to its chord is a line, units
+FLAT = 0.5
+
+NUMBER = re.compile(r'[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?')
+PATH_TOKEN = re.compile(r'[MmLlHhVvCcSsQqTtAaZz]|'
+                        r'[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?')
+TRANSFORM = re.compile(r'(matrix|translate|scale|rotate|skewX|skewY)'
+                       r'\s*\(([^)]*)\)')
+CLASS_RULE = re.compile(r'\.([\w-]+)\s*\{([^}]*)\}')
+
+IDENTITY = (1.0, 0.0, 0.0, 1.0, 0.0, 0.0)
+
+def multiply(m, n):
+    a, b, c, d, e, f = m
+    g, h, i, j, k, l = n
+    return (a * g + c * h, b * g + d * h, a * i + c * j, b * i + d * j,
+            a * k + c * l + e, b * k + d * l + f)
+
+def apply(m, p):
+    return (m[0] * p[0] + m[2] * p[1] + m[4], m[1] * p[0] + m[3] * p[1] + m[5])
+
+def parse_transform(text):
+    m = IDENTITY
+    for name, args in TRANSFORM.findall(text or ''):
+        v = [float(n) for n in NUMBER.findall(args)]
+        if name == 'matrix':
+            t = tuple(v)
+        elif name == 'translate':
+            t = (1, 0, 0, 1, v[0], v[1] if len(v) > 1 else 0)
+        elif name == 'scale':
+            t = (v[0], 0, 0, v[1] if len(v) > 1 else v[0], 0, 0)
+        elif name == 'rotate':
+            a = math.radians(v[0])
+            t = (math.cos(a), math.sin(a), -math.sin(a), math.cos(a), 0, 0)
+            if len(v) == 3:
+                t = multiply(multiply((1, 0, 0, 1, v[1], v[2]), t),
+                             (1, 0, 0, 1, -v[1], -v[2]))
+        elif name == 'skewX':
+            t = (1, 0, math.tan(math.radians(v[0])), 1, 0, 0)
+        else:
+            t = (1, math.tan(math.radians(v[0])), 0, 1, 0, 0)
+        m = multiply(m, t)
+    return m
+
+# Returns the cubics approximating an elliptical arc, as in the SVG
+# implementation notes (F.6).
+def arc_to_cubics(p0, rx, ry, phi, large, sweep, p1):
+    if p0 == p1:
+        return []
+    rx, ry = abs(rx), abs(ry)
+    if rx == 0 or ry == 0:
+        return [(p0, p1, p1)]
+    cp, sp = math.cos(math.radians(phi)), math.sin(math.radians(phi))
+    dx, dy = (p0[0] - p1[0]) / 2, (p0[1] - p1[1]) / 2
+    x1 = cp * dx + sp * dy
+    y1 = -sp * dx + cp * dy
+    lam = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry)
+    if lam > 1:
+        rx, ry = rx * math.sqrt(lam), ry * math.sqrt(lam)
+    num = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1
+    den = rx * rx * y1 * y1 + ry * ry * x1 * x1
+    k = math.sqrt(max(0, num / den))
+    if large == sweep:
+        k = -k
+    cx1, cy1 = k * rx * y1 / ry, -k * ry * x1 / rx
+    cx = cp * cx1 - sp * cy1 + (p0[0] + p1[0]) / 2
+    cy = sp * cx1 + cp * cy1 + (p0[1] + p1[1]) / 2
+    t0 = math.atan2((y1 - cy1) / ry, (x1 - cx1) / rx)
+    t1 = math.atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx)
+    dt = t1 - t0
+    if sweep and dt < 0:
+        dt += 2 * math.pi
+    elif not sweep and dt > 0:
+        dt -= 2 * math.pi
+    n = max(1, math.ceil(abs(dt) / (math.pi / 2) - 1e-9))
+    h = dt / n
+    kappa = 4 / 3 * math.tan(h / 4)
+
+    def point(t):
+        x, y = rx * math.cos(t), ry * math.sin(t)
+        return (cp * x - sp * y + cx, sp * x + cp * y + cy)
+
+    def tangent(t):
+        x, y = -rx * math.sin(t), ry * math.cos(t)
+        return (cp * x - sp * y, sp * x + cp * y)
+
+    cubics = []
+    for i in range(n):
+        a, b = t0 + i * h, t0 + (i + 1) * h
+        pa, pb = point(a), point(b)
+        ta, tb = tangent(a), tangent(b)
+        cubics.append(((pa[0] + kappa * ta[0], pa[1] + kappa * ta[1]),
+                       (pb[0] - kappa * tb[0], pb[1] - kappa * tb[1]),
+                       p1 if i == n - 1 else pb))
+    return cubics
+
+# Returns the contours of path data, each a start point and a list of segments,
+# ('L', p) or ('C', p1, p2, p3), in user units.
+def parse_path(d):
+    tokens = PATH_TOKEN.findall(d)
+    contours = []
+    cur = start = (0.0, 0.0)
+    last_ctrl = None # second control point of the last cubic or quadratic
+    last_cmd = ''
+    cmd = ''
+    closed = False
+    i = 0
+
+    def take(n):
+        nonlocal i
+        v = [float(t) for t in tokens[i:i + n]]
+        i += n
+        return v
+
+    while i < len(tokens):
+        if tokens[i].isalpha():
+            cmd = tokens[i]
+            i += 1
+            if cmd in 'Zz':
+                if contours:
+                    cur = start
+                    # drawing on without a moveto starts another contour there
+                    closed = True
+                last_cmd = cmd
+                last_ctrl = None
+                continue
+        elif cmd in 'Mm':
+            # coordinates after a moveto are linetos
+            cmd = 'L' if cmd == 'M' else 'l'
+        rel = cmd.islower()
+        ox, oy = cur if rel else (0.0, 0.0)
+        c = cmd.upper()
+        if closed and c != 'M':
+            contours.append((start, []))
+        closed = False
+        if c != 'M' and not contours:
+            raise ValueError('path data does not start with a moveto')
+        if c == 'M':
+            x, y = take(2)
+            cur = start = (ox + x, oy + y)
+            contours.append((cur, []))
+            last_ctrl = None
+        elif c in 'LHV':
+            if c == 'L':
+                x, y = take(2)
+                p = (ox + x, oy + y)
+            elif c == 'H':
+                p = (ox + take(1)[0], cur[1])
+            else:
+                p = (cur[0], oy + take(1)[0])
+            contours[-1][1].append(('L', p))
+            cur = p
+            last_ctrl = None
+        elif c in 'CS':
+            if c == 'C':
+                v = take(6)
+                p1 = (ox + v[0], oy + v[1])
+                v = v[2:]
+            else:
+                v = take(4)
+                if last_ctrl is not None and last_cmd in 'CcSs':
+                    p1 = (2 * cur[0] - last_ctrl[0], 2 * cur[1] - last_ctrl[1])
+                else:
+                    p1 = cur
+            p2 = (ox + v[0], oy + v[1])
+            p3 = (ox + v[2], oy + v[3])
+            contours[-1][1].append(('C', p1, p2, p3))
+            cur, last_ctrl = p3, p2
+        elif c in 'QT':
+            if c == 'Q':
+                v = take(4)
+                q = (ox + v[0], oy + v[1])
+                v = v[2:]
+            else:
+                v = take(2)
+                if last_ctrl is not None and last_cmd in 'QqTt':
+                    q = (2 * cur[0] - last_ctrl[0], 2 * cur[1] - last_ctrl[1])
+                else:
+                    q = cur
+            p = (ox + v[0], oy + v[1])
+            contours[-1][1].append(
+                ('C', (cur[0] + 2 / 3 * (q[0] - cur[0]),
+                       cur[1] + 2 / 3 * (q[1] - cur[1])),
+                 (p[0] + 2 / 3 * (q[0] - p[0]), p[1] + 2 / 3 * (q[1] - p[1])),
+                 p))
+            cur, last_ctrl = p, q
+        elif c == 'A':
+            rx, ry, phi, large, sweep, x, y = take(7)
+            p = (ox + x, oy + y)
+            for p1, p2, p3 in arc_to_cubics(cur, rx, ry, phi, int(large),
+                                            int(sweep), p):
+                contours[-1][1].append(('C', p1, p2, p3))
+            cur = p
+            last_ctrl = None
+        last_cmd = cmd
+    return contours
+
+def ellipse(cx, cy, rx, ry):
+    k = 4 / 3 * (math.sqrt(2) - 1)
+    return [((cx + rx, cy), [
+        ('C', (cx + rx, cy + k * ry), (cx + k * rx, cy + ry), (cx, cy + ry)),
+        ('C', (cx - k * rx, cy + ry), (cx - rx, cy + k * ry), (cx - rx, cy)),
+        ('C', (cx - rx, cy - k * ry), (cx - k * rx, cy - ry), (cx, cy - ry)),
+        ('C', (cx + k * rx, cy - ry), (cx + rx, cy - k * ry), (cx + rx, cy))])]
+
+def properties(el, classes):
+    props = {}
+    for cls in (el.get('class') or '').split():
+        props.update(classes.get(cls, {}))
+    for name in ('fill', 'fill-rule', 'display'):
+        if el.get(name) is not None:
+            props[name] = el.get(name).strip()
+    for decl in (el.get('style') or '').split(';'):
+        if ':' in decl:
+            name, value = decl.split(':', 1)
+            props[name.strip()] = value.strip()
+    return props
+
+def local(tag):
+    return tag.rsplit('}', 1)[-1]
+
+# Returns the filled shapes of an svg, (even_odd, contours), with the contours
+# in units of the icon.
+def shapes(svg_text):
+    root = ET.fromstring(svg_text)
+    classes = {}
+    for el in root.iter():
+        if local(el.tag) == 'style' and el.text:
+            for name, body in CLASS_RULE.findall(el.text):
+                classes[name] = dict(
+                    (k.strip(), v.strip()) for k, v in
+                    (decl.split(':', 1) for decl in body.split(';')
+                     if ':' in decl))
+    vb = [float(n) for n in NUMBER.findall(root.get('viewBox'))]
+    # the viewBox is fitted and centred in the icon, as Inkscape exports it
+    scale = UNITS / max(vb[2], vb[3])
+    view = (scale, 0, 0, scale, (UNITS - vb[2] * scale) / 2 - vb[0] * scale,
+            (UNITS - vb[3] * scale) / 2 - vb[1] * scale)
+
+    out = []
+
+    def visit(el, m, inherited):
+        tag = local(el.tag)
+        if tag in ('defs', 'metadata', 'style', 'namedview', 'title', 'desc',
+                   'clipPath', 'mask'):
+            return
+        props = dict(inherited)
+        props.update(properties(el, classes))
+        if props.get('display') == 'none':
+            return
+        m = multiply(m, parse_transform(el.get('transform')))
+        num = lambda name: float(NUMBER.match(el.get(name, '0')).group())
+        if tag == 'path':
+            contours = parse_path(el.get('d', ''))
+        elif tag == 'rect':
+            x, y, w, h = num('x'), num('y'), num('width'), num('height')
+            contours = [((x, y), [('L', (x + w, y)), ('L', (x + w, y + h)),
+                                  ('L', (x, y + h))])]
+        elif tag == 'circle':
+            contours = ellipse(num('cx'), num('cy'), num('r'), num('r'))
+        elif tag == 'ellipse':
+            contours = ellipse(num('cx'), num('cy'), num('rx'), num('ry'))
+        elif tag == 'polygon':
+            v = [float(n) for n in NUMBER.findall(el.get('points', ''))]
+            pts = list(zip(v[0::2], v[1::2]))
+            contours = [(pts[0], [('L', p) for p in pts[1:]])]
+        else:
+            for child in el:
+                visit(child, m, props)
+            return
+        if props.get('fill', 'black') == 'none' or not contours:
+            return
+        t = multiply(view, m)
+        out.append((props.get('fill-rule') == 'evenodd',
+                    [(apply(t, s), [(seg[0],) + tuple(apply(t, p)
+                                                      for p in seg[1:])
+                                    for seg in segs])
+                     for s, segs in contours]))
+
+    visit(root, IDENTITY, {})
+    return out
+
+def flat(p0, p1, p2, p3):
+    dx, dy = p3[0] - p0[0], p3[1] - p0[1]
+    length = math.hypot(dx, dy)
+    for p in (p1, p2):
+        if length == 0:
+            dist = math.hypot(p[0] - p0[0], p[1] - p0[1])
+        else:
+            dist = abs((p[0] - p0[0]) * dy - (p[1] - p0[1]) * dx) / length
+            # control points beyond the ends make a curve that turns back
+            t = ((p[0] - p0[0]) * dx + (p[1] - p0[1]) * dy) / (length * length)
+            if t < 0 or t > 1:
+                return False
+        if dist > FLAT:
+            return False
+    return True
+
+def encode_coordinate(v):
+    if -64 <= v < 64:
+        return bytes([v & 0x7F])
+    if not -16384 <= v < 16384:
+        raise ValueError('coordinate out of range')
+    return bytes([0x80 | ((v >> 8) & 0x7F), v & 0xFF])
+
+# Returns the vector icon path of an svg, as bytes.
+def tokenize(svg_text):
+    out = bytearray()
+    prev = (0, 0)
+
+    def point(p):
+        nonlocal prev
+        q = (round(p[0]), round(p[1]))
+        b = (encode_coordinate(q[0] - prev[0])
+             + encode_coordinate(q[1] - prev[1]))
+        prev = q
+        return b
+
+    for even_odd, contours in shapes(svg_text):
+        for start, segs in contours:
+            # the segments in runs of lines and cubics
+            runs = []
+            cur = start
+            for seg in segs:
+                if seg[0] == 'C' and flat(cur, *seg[1:]):
+                    seg = ('L', seg[3])
+                if seg[0] == 'L' and seg[1] == cur:
+                    continue
+                if not runs or runs[-1][0] != seg[0] \
+                        or len(runs[-1][1]) == MAX_RUN:
+                    runs.append((seg[0], []))
+                runs[-1][1].append(seg[1:])
+                cur = seg[-1]
+            if not runs:
+                continue
+            out.append(MOVE)
+            out += point(start)
+            for kind, pts in runs:
+                out.append((LINE if kind == 'L' else CUBIC) | (len(pts) - 1))
+                for seg in pts:
+                    for p in seg:
+                        out += point(p)
+        out.append(FILL | (EVEN_ODD if even_odd else 0))
+    out.append(END)
+    return bytes(out)
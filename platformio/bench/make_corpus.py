@@ -0,0 +1,140 @@
+# Benchmark corpus generator for esp32-weather-epd.
+# Copyright (C) 2022-2023  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Writes the forecasts in corpus/, as One Call JSON and in the binary format
+# served by proxy/owm_proxy.py. Each covers a different part of the renderer,
+# so that the benchmark (src/native/bench.cpp) exercises every drawing path.
+# test/test_owm_binary packs the JSON again with the proxy, and checks that it
+# decodes the same both ways. The output is deterministic, rerun this after
+# changing the binary format.
+
+import json
+import math
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', '..',
+                                'proxy'))
+from owm_proxy import pack_onecall, OWM_NUM_ALERTS  # noqa: E402
+
+# Wed, 24 May 2023 12:00:00 UTC
+START = 1684929600
+HOUR = 3600
+DAY = 24 * HOUR
+
+
+def weather(id, icon):
+    return [{'id': id, 'main': '', 'description': '', 'icon': icon}]
+
+
+def forecast(seed, temp, swing, pop, weather_id, alerts):
+    """Returns a One Call response with 48 hours and 8 days.
+
+    temp and swing set the mean and daily swing of the temperature (Kelvin),
+    pop(hour) the probability of precipitation of each hour.
+    """
+    rnd = random.Random(seed)
+    hourly = []
+    for h in range(48):
+        hourly.append({
+            'dt': START + h * HOUR,
+            'temp': temp + swing * math.sin(2 * math.pi * (h - 9) / 24)
+                    + rnd.uniform(-0.5, 0.5),
+            'pop': round(min(1.0, max(0.0, pop(h))), 2),
+        })
+    daily = []
+    for d in range(8):
+        daily.append({
+            'dt': START + d * DAY,
+            'moonrise': START + d * DAY + 5 * HOUR + d * 50 * 60,
+            'moonset': START + d * DAY + 19 * HOUR + d * 50 * 60,
+            'temp': {'min': temp - swing + rnd.uniform(-2, 2),
+                     'max': temp + swing + rnd.uniform(-2, 2)},
+            'wind_speed': rnd.uniform(1, 12),
+            'wind_gust': rnd.uniform(5, 20),
+            'clouds': rnd.randrange(0, 100),
+            'weather': weather(weather_id[d % len(weather_id)], '01d'),
+        })
+    return {
+        'current': {
+            'dt': START,
+            'sunrise': START - 6 * HOUR,
+            'sunset': START + 8 * HOUR,
+            'temp': hourly[0]['temp'],
+            'feels_like': hourly[0]['temp'] - 1.5,
+            'pressure': 1013,
+            'humidity': rnd.randrange(30, 95),
+            'clouds': rnd.randrange(0, 100),
+            'uvi': rnd.uniform(0, 9),
+            'visibility': 10000,
+            'wind_speed': rnd.uniform(1, 12),
+            'wind_gust': rnd.uniform(5, 20),
+            'wind_deg': rnd.randrange(0, 360),
+            'weather': weather(weather_id[0], '01d'),
+        },
+        'hourly': hourly,
+        'daily': daily,
+        'alerts': [{'event': e, 'start': START, 'end': START + DAY,
+                    'tags': [t]} for e, t in alerts],
+    }
+
+
+CORPUS = {
+    # no precipitation and no alerts, the least drawn
+    'clear': forecast(1, 295.0, 6.0, lambda h: 0.0, [800, 800, 801], []),
+    # high probability of precipitation every hour, the most graph bars
+    'rain': forecast(2, 288.0, 3.0, lambda h: 0.7 + 0.3 * math.sin(h / 3),
+                     [501, 502, 500, 521],
+                     [('Flood Watch', 'Flood')]),
+    # the maximum number of alerts, with long names that wrap
+    'storms': forecast(3, 300.0, 5.0, lambda h: 0.5 * (h % 6 < 3),
+                       [211, 202, 212, 201],
+                       [('Severe Thunderstorm Warning issued for the '
+                         'northern and central counties until 9 PM',
+                         'Thunderstorm'),
+                        ('Tornado Watch', 'Tornado'),
+                        ('Flash Flood Warning', 'Flood'),
+                        ('Special Marine Warning', 'Marine'),
+                        ('Heat Advisory', 'Extreme high temperature'),
+                        ('Air Quality Alert', 'Air quality'),
+                        ('Small Craft Advisory', 'Marine'),
+                        ('Rip Current Statement', 'Coastal event')]
+                       [:OWM_NUM_ALERTS]),
+    # below freezing, negative axis labels
+    'winter': forecast(4, 265.0, 4.0, lambda h: 0.3 + 0.2 * math.cos(h / 5),
+                       [601, 602, 600, 611],
+                       [('Winter Storm Warning', 'Snow/Ice'),
+                        ('Wind Chill Advisory', 'Extreme low temperature')]),
+}
+
+
+def main():
+    out = os.path.join(os.path.dirname(__file__), 'corpus')
+    for name, onecall in CORPUS.items():
+        path = os.path.join(out, name + '.json')
+        with open(path, 'w', encoding='utf-8') as f:
+            json.dump(onecall, f, indent=2)
+            f.write('\n')
+        print('Wrote ' + path)
+        path = os.path.join(out, name + '.bin')
+        with open(path, 'wb') as f:
+            f.write(pack_onecall(onecall, 48, 8, OWM_NUM_ALERTS))
+        print('Wrote ' + path)
+
+
+if __name__ == '__main__':
+    main()
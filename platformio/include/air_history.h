@@ -0,0 +1,55 @@
+/* Air pollution history declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2023  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AIR_HISTORY_H__
+#define __AIR_HISTORY_H__
+
+#include <cstdint>
+#include "api_response.h"
+
+// One more than the longest averaging period, so that the sum of the last
+// OWM_NUM_AIR_POLLUTION hours is the difference of two stored running totals.
+#define AIR_HISTORY_LEN (OWM_NUM_AIR_POLLUTION + 1)
+
+/*
+ * Hourly air pollution history, kept in RTC memory across deep-sleep so that
+ * only the hours since the last wake need to be requested.
+ *
+ * Each array is a ring buffer of running totals (prefix sums) of that
+ * pollutant's hourly concentration. The sum of the last n hours is the newest
+ * total minus the total n entries before it, so any average costs O(1), see
+ * getAvgConc().
+ */
+typedef struct air_history
+{
+  int64_t dt;                     // Time of the newest hour, Unix, UTC
+  int     newest;                 // Index of the newest hour's running totals
+  int     hours;                  // Number of hours held (max OWM_NUM_AIR_POLLUTION)
+  double  co[AIR_HISTORY_LEN];    // Running totals of CO, μg/m^3
+  double  no[AIR_HISTORY_LEN];    // Running totals of NO, μg/m^3
+  double  no2[AIR_HISTORY_LEN];   // Running totals of NO2, μg/m^3
+  double  o3[AIR_HISTORY_LEN];    // Running totals of O3, μg/m^3
+  double  so2[AIR_HISTORY_LEN];   // Running totals of SO2, μg/m^3
+  double  pm2_5[AIR_HISTORY_LEN]; // Running totals of PM2.5, μg/m^3
+  double  pm10[AIR_HISTORY_LEN];  // Running totals of PM10, μg/m^3
+  double  nh3[AIR_HISTORY_LEN];   // Running totals of NH3, μg/m^3
+} air_history_t;
+
+int64_t airHistoryStart(const air_history_t &h, int64_t now);
+void airHistoryUpdate(air_history_t &h, const owm_resp_air_pollution_t &r);
+
+#endif
@@ -206,14 +206,31 @@ typedef struct owm_components
 typedef struct owm_resp_air_pollution
 {
   owm_coord_t      coord;
+  int              count;                             // Number of hourly records received
   int              main_aqi[OWM_NUM_AIR_POLLUTION];   // Air Quality Index. Possible values: 1, 2, 3, 4, 5. Where 1 = Good, 2 = Fair, 3 = Moderate, 4 = Poor, 5 = Very Poor.
   owm_components_t components;
   int64_t          dt[OWM_NUM_AIR_POLLUTION];         // Date and time, Unix, UTC;
 } owm_resp_air_pollution_t;
 
-DeserializationError deserializeOneCall(WiFiClient &json,
-                                        owm_resp_onecall_t &r);
-DeserializationError deserializeAirQuality(WiFiClient &json,
+/*
+ * Specifies how much of a One Call response is needed, so that decoding can
+ * stop as soon as the last needed value has been read.
+ */
+typedef struct owm_onecall_filter
+{
+  int     hourly;           // Number of hourly forecasts needed
+  int     daily;            // Number of daily forecasts needed
+  int     alerts;           // Max number of alerts needed, 0 if alerts are not used
+} owm_onecall_filter_t;
+
+DeserializationError deserializeOneCall(Stream &json,
+                                        owm_resp_onecall_t &r,
+                                        const owm_onecall_filter_t &filter,
+                                        size_t &bytesRead);
+DeserializationError deserializeOneCallAlerts(Stream &json,
+                                              std::vector<owm_alerts_t> &alerts,
+                                              int maxAlerts);
+DeserializationError deserializeAirQuality(Stream &json,
                                            owm_resp_air_pollution_t &r);
 
 
@@ -19,13 +19,24 @@
 #define __CLIENT_UTILS_H__
 
 #include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include "air_history.h"
+#include "api_response.h"
 
 wl_status_t startWiFi(int &wifiRSSI);
 void killWiFi();
 bool setupTime(tm *timeInfo);
+bool restoreTime(tm *timeInfo);
 bool printLocalTime(tm *timeInfo);
-int getOWMonecall(WiFiClient &client, owm_resp_onecall_t &r);
-int getOWMairpollution(WiFiClient &client, owm_resp_air_pollution_t &r);
+#ifdef PIO_UNIT_TESTING
+void ageWiFiLease(int64_t seconds);
+#endif
+int getOWMonecall(WiFiClient &client, HTTPClient &http, owm_resp_onecall_t &r);
+int getOWMonecallProxy(WiFiClient &client, HTTPClient &http,
+                       owm_resp_onecall_t &r);
+int getOWMairpollution(WiFiClient &client, HTTPClient &http,
+                       owm_resp_air_pollution_t &r, air_history_t &h);
 
 #endif
 
@@ -38,6 +38,75 @@
   #define ACCENT_COLOR GxEPD_RED
 #endif
 
+// PAGE HEIGHT
+// The display is drawn one page of this many rows at a time, the page buffer
+// takes 100 bytes per row (200 for 3 color displays). With more than one page
+// the drawing calls are kept in a list (about 10KB) and replayed for each
+// page. Smaller pages save memory at the cost of more replays.
+#ifdef DISP_BW
+  #define DISP_PAGE_HEIGHT 480
+#endif
+#ifdef DISP_3C
+  #define DISP_PAGE_HEIGHT 240
+#endif
+
+// BANDS
+// Each page is drawn in two bands of rows at the same time, the upper half on
+// the core that runs setup() and the lower half on the other core, and sent to
+// the panel once both are done. The drawing calls are then kept in a list
+// (about 10KB) even when the page is the whole display, and the second band
+// takes another 5KB of glyph cache. How much sooner the frame is drawn has
+// only been measured on the build machine so far (see bench/README), not on
+// the ESP32, so this is off by default. Uncomment to draw on both cores.
+// #define DRAW_IN_BANDS
+
+// PARTIAL REFRESH
+// If FULL_REFRESH_INTERVAL is defined, black/white displays are only refreshed
+// where the image changed since the last refresh, which is quicker and uses
+// less power. Partial refreshes leave some ghosting, so every
+// FULL_REFRESH_INTERVAL refreshes the whole display is refreshed instead.
+// This is for black/white displays only (DISP_BW). 3 color displays can not be
+// refreshed partially, so with DISP_3C it is ignored and the whole display is
+// always refreshed. (Also only used when DISP_PAGE_HEIGHT is the height of the
+// display.) It has not yet been checked on a GxEPD2_750_T7 or GxEPD2_750c_Z08
+// panel, only on the build machine, so this is off by default. Uncomment to
+// refresh partially.
+// #define FULL_REFRESH_INTERVAL 12
+
+// ICON PACK
+// Icons are compiled into the firmware unless ICON_PACK is defined. Then they
+// are drawn from the "icons" flash data partition instead (see
+// partitions_icon_pack.csv), which is only written when icons.bin is uploaded,
+// so firmware updates are smaller and quicker. ICON_PACK needs that partition,
+// so rather than uncommenting it here, build and upload with the
+// dfrobot_firebeetle2_esp32e_icon_pack env, which defines it and writes and
+// uploads icons.bin along with the firmware:
+//   pio run -e dfrobot_firebeetle2_esp32e_icon_pack -t upload
+// #define ICON_PACK
+
+// VECTOR ICONS
+// Icons are bitmaps, rendered from their svgs at each size they are drawn at.
+// If VECTOR_ICONS is defined, they are drawn from the shapes of the svgs
+// instead (see vector_icon.h), which take less flash than the bitmaps but
+// longer to draw. Edges may differ from the bitmaps by a pixel. Takes
+// precedence over ICON_PACK.
+// Uncomment to draw vector icons.
+// #define VECTOR_ICONS
+
+// CHROME LAYER
+// If CHROME_LAYER is defined, the parts of the dashboard that are the same in
+// every frame, the icons and labels of the current weather data and the x
+// axis, grid lines and PoP labels of the outlook graph, are copied from
+// include/chrome_layer.h (about 26KB of flash) instead of being drawn. The
+// layer in the repository is drawn for the default locale, font and icons, by
+// the native renderer. It is not redrawn when building, so after changing any
+// of them, redraw it with `program -l include/chrome_layer.h` before
+// uncommenting this. (A layer of another locale or font is not used, the
+// chrome is then drawn every frame instead.) This is off by default so that
+// the configuration can be changed without redrawing it. Uncomment to copy
+// the chrome from the layer.
+// #define CHROME_LAYER
+
 // LOCALE
 // If your locale is not here, you can add it by copying and modifying one of
 // the files in src/locales. Please feel free to create a pull request to add
@@ -104,19 +173,17 @@
 // #define UNITED_STATES_AQI
 
 // WIND ICON PRECISION
-// The wind direction icon shown to the left of the wind speed can indicate wind
-// direction with a minimum error of ±0.5°. This uses more flash storage because
-// 360 24x24 wind direction icons must be stored, totaling ~25kB. For either
-// preference or incase flash space becomes a concern there are a handful of
-// selectable options listed below. 360 points seems excessive, but the option
-// is there.
+// The wind direction arrow shown to the left of the wind speed is drawn at
+// runtime, so it can indicate wind direction with a minimum error of ±0.5° at
+// no extra cost in flash. The direction can be rounded to fewer points, if
+// preferred, with one of the options listed below.
 //
-// DIRECTIONS                 #     ERROR  STORAGE  
-// Cardinal                   4  ±45.000°     288B  E
-// Ordinal                    8  ±22.500°     576B  NE
-// Secondary Intercardinal   16  ±11.250°   1,152B  NNE
-// Tertiary Intercardinal    32   ±5.625°   2,304B  NbE
-// (360)                    360   ±0.500°  25,920B  1°
+// DIRECTIONS                 #     ERROR
+// Cardinal                   4  ±45.000°  E
+// Ordinal                    8  ±22.500°  NE
+// Secondary Intercardinal   16  ±11.250°  NNE
+// Tertiary Intercardinal    32   ±5.625°  NbE
+// (360)                    360   ±0.500°  1°
 // Uncomment your preferred wind level direction precision.
 // (exactly 1 must be defined)
 // #define WIND_DIRECTIONS_CARDINAL
@@ -163,8 +230,23 @@
 // alerts in English only. Any combination of these factors may make it
 // undesirable to display alerts in some regions.
 // Disable alerts by defining the DISABLE_ALERTS macro.
+// Alerts come last in the One Call response and are only there while active,
+// so a response that includes them is always downloaded in full (~30kB). To
+// let the forecast download stop once the last daily forecast drawn is read,
+// alerts are fetched with a separate, small One Call request, which counts
+// towards the daily API call limit. DISABLE_ALERTS skips that request. The
+// proxy (see USE_OWM_PROXY) sends no more than is drawn either way.
 // #define DISABLE_ALERTS
 
+// OPENWEATHERMAP PROXY
+// Instead of requesting One Call from OpenWeatherMap directly, the forecast can
+// be requested through a proxy running on your local network, see
+// esp32-weather-epd/proxy/README. The proxy sends only the fields that are
+// drawn, in a compact binary format (~1kB instead of ~30kB of JSON), which
+// shortens the time spent with WiFi on. Set the proxy's address in config.cpp.
+// Enable the proxy by defining the USE_OWM_PROXY macro.
+// #define USE_OWM_PROXY
+
 // Set the below constants in "config.cpp"
 extern const uint8_t PIN_BAT_ADC;
 extern const uint8_t PIN_EPD_BUSY;
@@ -179,9 +261,12 @@ extern const uint8_t PIN_BME_SCL;
 extern const uint8_t BME_ADDRESS;
 extern char *WIFI_SSID;
 extern char *WIFI_PASSWORD;
+extern const long WIFI_LEASE_MINUTES;
 extern String OWM_APIKEY;
 extern const String OWM_ENDPOINT;
 extern const String OWM_ONECALL_VERSION;
+extern const String OWM_PROXY_ENDPOINT;
+extern const uint16_t OWM_PROXY_PORT;
 extern String LAT;
 extern String LON;
 extern String CITY_STRING;
@@ -192,6 +277,8 @@ extern const char *DATE_FORMAT;
 extern const char *REFRESH_TIME_FORMAT;
 extern const char *NTP_SERVER_1;
 extern const char *NTP_SERVER_2;
+extern const long TIME_SYNC_MAX_AGE;
+extern const long TIME_MAX_DRIFT;
 extern long SLEEP_DURATION;
 extern const int BED_TIME;
 extern const int WAKE_TIME;
@@ -204,5 +291,7 @@ extern const float CRIT_LOW_BATTERY_VOLTAGE;
 extern const unsigned long LOW_BATTERY_SLEEP_INTERVAL;
 extern const unsigned long VERY_LOW_BATTERY_SLEEP_INTERVAL;
 extern unsigned long ERROR_SLEEP_DIV;
+extern const long SNAPSHOT_FRESH_MINUTES;
+extern const long SNAPSHOT_MAX_AGE_MINUTES;
 
 #endif
@@ -20,7 +20,9 @@
 
 #include <vector>
 #include <time.h>
+#include "air_history.h"
 #include "api_response.h"
+#include "icons/icons.h"
 
 enum alert_category {
   NOT_FOUND = -1,
@@ -51,25 +53,25 @@ enum alert_category {
 };
 
 int calcBatPercent(double v);
-const uint8_t *getBatBitmap24(int batPercent);
+icon_id_t getBatBitmap24(int batPercent);
 void getDateStr(String &s, tm *timeInfo);
 void getRefreshTimeStr(String &s, bool timeSuccess, tm *timeInfo);
 void toTitleCase(String &text);
 void truncateExtraAlertInfo(String &text);
 void filterAlerts(std::vector<owm_alerts_t> &resp, int *ignore_list);
 const char *getUVIdesc(unsigned int uvi);
-float getAvgConc(float pollutant[], int hours);
-int getAQI(owm_resp_air_pollution_t &p);
+float getAvgConc(const air_history_t &h, const double totals[], int hours);
+int getAQI(const air_history_t &h);
 const char *getAQIdesc(int aqi);
 const char *getWiFidesc(int rssi);
-const uint8_t *getWiFiBitmap16(int rssi);
-const uint8_t *getForecastBitmap64(owm_daily_t &daily);
-const uint8_t *getCurrentConditionsBitmap196(owm_current_t &current,
+icon_id_t getWiFiBitmap16(int rssi);
+icon_id_t getForecastBitmap64(owm_daily_t &daily);
+icon_id_t getCurrentConditionsBitmap196(owm_current_t &current,
                                              owm_daily_t   &today);
-const uint8_t *getAlertBitmap32(owm_alerts_t &alert);
-const uint8_t *getAlertBitmap48(owm_alerts_t &alert);
+icon_id_t getAlertBitmap32(owm_alerts_t &alert);
+icon_id_t getAlertBitmap48(owm_alerts_t &alert);
 enum alert_category getAlertCategory(owm_alerts_t &alert);
-const uint8_t *getWindBitmap24(int windDeg);
+float roundWindDirection(int windDeg);
 const char *getHttpResponsePhrase(int code);
 const char *getWifiStatusPhrase(wl_status_t status);
 
@@ -0,0 +1,154 @@
+/* Font metrics declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2023  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __FONT_METRICS_H__
+#define __FONT_METRICS_H__
+
+#include <cstdint>
+#include <gfxfont.h>
+
+/*
+ * Text is measured as Adafruit_GFX::getTextBounds measures it with text size 1
+ * and text wrap off, as initDisplay sets them, from a cursor at (0, 0). Only
+ * the glyphs' advances and bounding boxes are needed, so they are read
+ * straight from the tables instead of making a bounds pass with the display.
+ *
+ * The metrics of the fonts in use are generated from their GFXfont headers as
+ * constexpr tables when building, see fonts/font_metrics.py, so that constant
+ * strings are measured when compiling:
+ *
+ *   constexpr uint16_t w = textWidth(FONT_8pt8b_metrics, "|");
+ *
+ * Strings only known at run time are measured from the GFXfont the display
+ * draws with, see textWidth(const GFXfont &, const char *).
+ */
+
+// The bounding box of a glyph, relative to the cursor, and its advance.
+typedef struct font_glyph_metrics
+{
+  uint8_t xAdvance;
+  int8_t  left;
+  int8_t  right;  // inclusive
+  int8_t  top;
+  int8_t  bottom; // inclusive
+} font_glyph_metrics_t;
+
+typedef struct font_metrics
+{
+  const font_glyph_metrics_t *glyph; // first to last
+  uint16_t                    first;
+  uint16_t                    last;
+  uint8_t                     yAdvance;
+} font_metrics_t;
+
+// Cursor and bounds of text being measured, as in getTextBounds.
+typedef struct text_bounds
+{
+  int32_t x;
+  int32_t y;
+  int32_t minX;
+  int32_t minY;
+  int32_t maxX;
+  int32_t maxY;
+} text_bounds_t;
+
+// The bounds of no text yet, getTextBounds starts from the same values.
+#define TEXT_BOUNDS_EMPTY {0, 0, 0x7FFF, 0x7FFF, -1, -1}
+
+/* The functions below are C++11 constexpr, a single return each, so that the
+ * firmware's toolchain folds them.
+ */
+
+constexpr int32_t textMin(int32_t a, int32_t b)
+{
+  return a < b ? a : b;
+} // end textMin
+
+constexpr int32_t textMax(int32_t a, int32_t b)
+{
+  return a > b ? a : b;
+} // end textMax
+
+/* Returns b with a glyph added at its cursor.
+ */
+constexpr text_bounds_t textGlyphBounds(const font_glyph_metrics_t &g,
+                                        const text_bounds_t &b)
+{
+  return text_bounds_t{b.x + g.xAdvance, b.y,
+                       textMin(b.minX, b.x + g.left),
+                       textMin(b.minY, b.y + g.top),
+                       textMax(b.maxX, b.x + g.right),
+                       textMax(b.maxY, b.y + g.bottom)};
+} // end textGlyphBounds
+
+/* Returns b with character c added, as Adafruit_GFX::charBounds adds it. A
+ * newline moves the cursor to the start of the next line, characters the font
+ * has no glyph for, '\r' among them, are skipped.
+ */
+constexpr text_bounds_t textCharBounds(const font_metrics_t &font, uint8_t c,
+                                       const text_bounds_t &b)
+{
+  return c == '\n'
+         ? text_bounds_t{0, b.y + font.yAdvance, b.minX, b.minY, b.maxX, b.maxY}
+         : c < font.first || c > font.last
+           ? b
+           : textGlyphBounds(font.glyph[c - font.first], b);
+} // end textCharBounds
+
+/* Returns b with text added.
+ */
+constexpr text_bounds_t textBounds(const font_metrics_t &font,
+                                   const char *text,
+                                   const text_bounds_t &b = TEXT_BOUNDS_EMPTY)
+{
+  return *text == '\0'
+         ? b
+         : textBounds(font, text + 1,
+                      textCharBounds(font, static_cast<uint8_t>(*text), b));
+} // end textBounds
+
+/* Returns the width in pixels of text, as getTextBounds.
+ */
+constexpr uint16_t textWidth(const text_bounds_t &b)
+{
+  return b.maxX >= b.minX ? static_cast<uint16_t>(b.maxX - b.minX + 1) : 0;
+} // end textWidth
+
+constexpr uint16_t textWidth(const font_metrics_t &font, const char *text)
+{
+  return textWidth(textBounds(font, text));
+} // end textWidth
+
+/* Returns the height in pixels of text, as getTextBounds.
+ */
+constexpr uint16_t textHeight(const text_bounds_t &b)
+{
+  return b.maxY >= b.minY ? static_cast<uint16_t>(b.maxY - b.minY + 1) : 0;
+} // end textHeight
+
+constexpr uint16_t textHeight(const font_metrics_t &font, const char *text)
+{
+  return textHeight(textBounds(font, text));
+} // end textHeight
+
+void textAddChar(const GFXfont &font, uint8_t c, text_bounds_t &b);
+text_bounds_t textBounds(const GFXfont &font, const char *text,
+                         const text_bounds_t &b = TEXT_BOUNDS_EMPTY);
+uint16_t textWidth(const GFXfont &font, const char *text);
+uint16_t textHeight(const GFXfont &font, const char *text);
+
+#endif
@@ -17,6 +17,7 @@
 #include "FreeMono/FreeMono_7pt8b.h"
 #include "FreeMono/FreeMono_8pt8b.h"
 #include "FreeMono/FreeMono_9pt8b.h"
+#include "FreeMono_metrics.h"
 
 #define FONT_10pt8b FreeMono_10pt8b
 #define FONT_11pt8b FreeMono_11pt8b
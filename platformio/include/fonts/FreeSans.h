@@ -17,6 +17,7 @@
 #include "FreeSans/FreeSans_7pt8b.h"
 #include "FreeSans/FreeSans_8pt8b.h"
 #include "FreeSans/FreeSans_9pt8b.h"
+#include "FreeSans_metrics.h"
 
 #define FONT_10pt8b FreeSans_10pt8b
 #define FONT_11pt8b FreeSans_11pt8b
@@ -17,6 +17,7 @@
 #include "FreeSerif/FreeSerif_7pt8b.h"
 #include "FreeSerif/FreeSerif_8pt8b.h"
 #include "FreeSerif/FreeSerif_9pt8b.h"
+#include "FreeSerif_metrics.h"
 
 #define FONT_10pt8b FreeSerif_10pt8b
 #define FONT_11pt8b FreeSerif_11pt8b
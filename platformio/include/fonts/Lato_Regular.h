@@ -17,6 +17,7 @@
 #include "Lato_Regular/Lato_Regular_7pt8b.h"
 #include "Lato_Regular/Lato_Regular_8pt8b.h"
 #include "Lato_Regular/Lato_Regular_9pt8b.h"
+#include "Lato_Regular_metrics.h"
 
 #define FONT_10pt8b Lato_Regular_10pt8b
 #define FONT_11pt8b Lato_Regular_11pt8b
@@ -17,6 +17,7 @@
 #include "Montserrat_Regular/Montserrat_Regular_7pt8b.h"
 #include "Montserrat_Regular/Montserrat_Regular_8pt8b.h"
 #include "Montserrat_Regular/Montserrat_Regular_9pt8b.h"
+#include "Montserrat_Regular_metrics.h"
 
 #define FONT_10pt8b Montserrat_Regular_10pt8b
 #define FONT_11pt8b Montserrat_Regular_11pt8b
@@ -17,6 +17,7 @@
 #include "OpenSans_Regular/OpenSans_Regular_7pt8b.h"
 #include "OpenSans_Regular/OpenSans_Regular_8pt8b.h"
 #include "OpenSans_Regular/OpenSans_Regular_9pt8b.h"
+#include "OpenSans_Regular_metrics.h"
 
 #define FONT_10pt8b OpenSans_Regular_10pt8b
 #define FONT_11pt8b OpenSans_Regular_11pt8b
@@ -17,6 +17,7 @@
 #include "Poppins_Regular/Poppins_Regular_7pt8b.h"
 #include "Poppins_Regular/Poppins_Regular_8pt8b.h"
 #include "Poppins_Regular/Poppins_Regular_9pt8b.h"
+#include "Poppins_Regular_metrics.h"
 
 #define FONT_10pt8b Poppins_Regular_10pt8b
 #define FONT_11pt8b Poppins_Regular_11pt8b
@@ -17,6 +17,7 @@
 #include "Quicksand_Regular/Quicksand_Regular_7pt8b.h"
 #include "Quicksand_Regular/Quicksand_Regular_8pt8b.h"
 #include "Quicksand_Regular/Quicksand_Regular_9pt8b.h"
+#include "Quicksand_Regular_metrics.h"
 
 #define FONT_10pt8b Quicksand_Regular_10pt8b
 #define FONT_11pt8b Quicksand_Regular_11pt8b
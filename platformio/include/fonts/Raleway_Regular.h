@@ -17,6 +17,7 @@
 #include "Raleway_Regular/Raleway_Regular_7pt8b.h"
 #include "Raleway_Regular/Raleway_Regular_8pt8b.h"
 #include "Raleway_Regular/Raleway_Regular_9pt8b.h"
+#include "Raleway_Regular_metrics.h"
 
 #define FONT_10pt8b Raleway_Regular_10pt8b
 #define FONT_11pt8b Raleway_Regular_11pt8b
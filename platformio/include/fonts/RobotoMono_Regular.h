@@ -17,6 +17,7 @@
 #include "RobotoMono_Regular/RobotoMono_Regular_7pt8b.h"
 #include "RobotoMono_Regular/RobotoMono_Regular_8pt8b.h"
 #include "RobotoMono_Regular/RobotoMono_Regular_9pt8b.h"
+#include "RobotoMono_Regular_metrics.h"
 
 #define FONT_10pt8b RobotoMono_Regular_10pt8b
 #define FONT_11pt8b RobotoMono_Regular_11pt8b
@@ -17,6 +17,7 @@
 #include "RobotoSlab_Regular/RobotoSlab_Regular_7pt8b.h"
 #include "RobotoSlab_Regular/RobotoSlab_Regular_8pt8b.h"
 #include "RobotoSlab_Regular/RobotoSlab_Regular_9pt8b.h"
+#include "RobotoSlab_Regular_metrics.h"
 
 #define FONT_10pt8b RobotoSlab_Regular_10pt8b
 #define FONT_11pt8b RobotoSlab_Regular_11pt8b
@@ -17,6 +17,7 @@
 #include "Roboto_Regular/Roboto_Regular_7pt8b.h"
 #include "Roboto_Regular/Roboto_Regular_8pt8b.h"
 #include "Roboto_Regular/Roboto_Regular_9pt8b.h"
+#include "Roboto_Regular_metrics.h"
 
 #define FONT_10pt8b Roboto_Regular_10pt8b
 #define FONT_11pt8b Roboto_Regular_11pt8b
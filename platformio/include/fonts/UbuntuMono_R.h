@@ -17,6 +17,7 @@
 #include "UbuntuMono_R/UbuntuMono_R_7pt8b.h"
 #include "UbuntuMono_R/UbuntuMono_R_8pt8b.h"
 #include "UbuntuMono_R/UbuntuMono_R_9pt8b.h"
+#include "UbuntuMono_R_metrics.h"
 
 #define FONT_10pt8b UbuntuMono_R_10pt8b
 #define FONT_11pt8b UbuntuMono_R_11pt8b
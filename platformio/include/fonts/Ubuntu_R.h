@@ -17,6 +17,7 @@
 #include "Ubuntu_R/Ubuntu_R_7pt8b.h"
 #include "Ubuntu_R/Ubuntu_R_8pt8b.h"
 #include "Ubuntu_R/Ubuntu_R_9pt8b.h"
+#include "Ubuntu_R_metrics.h"
 
 #define FONT_10pt8b Ubuntu_R_10pt8b
 #define FONT_11pt8b Ubuntu_R_11pt8b
@@ -0,0 +1,335 @@
+/* Framebuffer declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2023  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __FRAMEBUFFER_H__
+#define __FRAMEBUFFER_H__
+
+#include <stdint.h>
+#include <vector>
+#include <Adafruit_GFX.h>
+#include "config.h"
+#include "vector_icon.h"
+#ifdef DRAW_IN_BANDS
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+/*
+ * GxEPD2 is only used to send finished pages to the panel. Its own page buffer
+ * is private, so it is kept to a few rows and the frame is drawn into the
+ * buffers of Framebuffer instead, which the renderer may write to directly.
+ */
+#define EPD_PANEL_PAGE_HEIGHT 8
+
+#ifdef DISP_BW
+#include <GxEPD2_BW.h>
+typedef GxEPD2_750_T7 epd_driver_t;
+typedef GxEPD2_BW<epd_driver_t, EPD_PANEL_PAGE_HEIGHT> epd_panel_t;
+#endif
+#ifdef DISP_3C
+#include <GxEPD2_3C.h>
+typedef GxEPD2_750c_Z08 epd_driver_t;
+typedef GxEPD2_3C<epd_driver_t, EPD_PANEL_PAGE_HEIGHT> epd_panel_t;
+#endif
+
+#define FB_PAGE_HEIGHT DISP_PAGE_HEIGHT
+// Room made in the display list up front, the dashboard takes 480-550 calls.
+#define FB_DISPLAY_LIST_RESERVE 640
+
+#define FB_WIDTH      epd_driver_t::WIDTH
+#define FB_HEIGHT     epd_driver_t::HEIGHT
+#define FB_ROW_BYTES  (FB_WIDTH / 8)
+#define FB_PAGE_BYTES (FB_ROW_BYTES * FB_PAGE_HEIGHT)
+
+// Tiles compared between frames, to refresh only the ones that changed.
+// The width is a multiple of 8, as partial refresh windows must be.
+#define FB_TILE_WIDTH  80
+#define FB_TILE_HEIGHT 40
+#define FB_TILE_COLS   (FB_WIDTH / FB_TILE_WIDTH)
+#define FB_TILE_ROWS   (FB_HEIGHT / FB_TILE_HEIGHT)
+// More changed tiles than this and the whole display is refreshed instead.
+#define FB_PARTIAL_MAX_TILES (FB_TILE_COLS * FB_TILE_ROWS / 2)
+
+// Glyphs of GFXfonts, decoded into bitmaps once and kept for when they are
+// drawn again. The largest glyph of FreeSans is 414 bytes.
+#define FB_GLYPH_CACHE_BYTES   4096
+#define FB_GLYPH_CACHE_ENTRIES 128
+
+// With DRAW_IN_BANDS, the lower half of each page is drawn by a task on core
+// 0, while the upper half is drawn on core 1, where Arduino runs setup().
+#define FB_BAND_TASK_CORE  0
+#define FB_BAND_TASK_STACK 4096
+
+// Polygon vertices are in fixed point, with this many fractional bits.
+#define FB_SUBPIXEL_SHIFT     8
+#define FB_POLYGON_MAX_POINTS 16
+
+/*
+ * Hashes of the tiles of the frame on the display. Kept in RTC memory by the
+ * firmware, so that the next frame can be compared against it.
+ */
+typedef struct frame_tiles
+{
+  uint32_t hash[FB_TILE_ROWS][FB_TILE_COLS]; // CRC-32 of each tile
+  uint16_t partialRefreshes; // Partial refreshes since the last full refresh
+  bool     valid;            // Hashes are of what is on the display
+} frame_tiles_t;
+
+/*
+ * A rectangle of the display, in pixels.
+ */
+typedef struct fb_window
+{
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+} fb_window_t;
+
+void hashFrameTiles(const uint8_t *frame,
+                    uint32_t hash[FB_TILE_ROWS][FB_TILE_COLS]);
+int diffFrameTiles(const uint32_t prev[FB_TILE_ROWS][FB_TILE_COLS],
+                   const uint32_t cur[FB_TILE_ROWS][FB_TILE_COLS],
+                   bool dirty[FB_TILE_ROWS][FB_TILE_COLS]);
+int getDirtyWindows(const bool dirty[FB_TILE_ROWS][FB_TILE_COLS],
+                    fb_window_t windows[FB_TILE_ROWS]);
+
+typedef enum draw_op
+{
+  DRAW_PIXEL,
+  DRAW_FAST_HLINE,
+  DRAW_FAST_VLINE,
+  DRAW_FILL_RECT,
+  DRAW_LINE,
+  DRAW_CHAR,
+  DRAW_INVERTED_BITMAP,
+  DRAW_ICON,
+  DRAW_DOTTED_RECT,
+  DRAW_VECTOR_ICON,
+  DRAW_FILL_SCREEN,
+  DRAW_SET_ROTATION,
+  DRAW_LAYER
+} draw_op_t;
+
+/*
+ * A drawing call recorded in the display list of Framebuffer.
+ */
+typedef struct draw_cmd
+{
+  uint8_t     op;     // draw_op_t
+  uint8_t     arg;    // char, dot step or rotation
+  uint16_t    color;
+  int16_t     x0;
+  int16_t     y0;
+  int16_t     x1;     // end of a line, otherwise width (text size of a char)
+  int16_t     y1;     // end of a line, otherwise height (text size of a char)
+  const void *data;   // bitmap, icon or layer, or font of a char
+} draw_cmd_t;
+
+/*
+ * Draws into a band of rows of the display, from getBandY() down, whose page
+ * buffers are given with setBand(). Everything drawn is clipped to the band,
+ * so that a frame may be drawn a band at a time, each replaying the same
+ * display list (see Framebuffer).
+ *
+ * Buffers are in the panel's native format, one bit per pixel, rows of
+ * FB_ROW_BYTES, most significant bit leftmost. A bit of 1 is white. 3-color
+ * displays have a second plane where a bit of 0 is the accent color.
+ *
+ * Text in a GFXfont is drawn a glyph at a time, each decoded once into a
+ * bitmap and kept in the glyph cache, and then blitted like drawInvertedBitmap
+ * blits, a byte at a time.
+ */
+class FramebufferBand : public Adafruit_GFX
+{
+public:
+  FramebufferBand();
+
+  void setBand(uint8_t *black, uint8_t *color, int16_t y, int16_t rows);
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  virtual void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                  int16_t w, int16_t h, uint16_t color);
+  virtual void drawIcon(int16_t x, int16_t y, const uint8_t icon[], int16_t w,
+                        int16_t h, uint16_t color);
+  virtual void drawDottedHLine(int16_t x, int16_t y, int16_t w, uint8_t step,
+                               uint16_t color);
+  virtual void fillDottedRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                              uint8_t step, uint16_t color);
+  void fillPolygon(const int32_t x[], const int32_t y[], uint8_t n,
+                   uint16_t color);
+  virtual void drawVectorIcon(int16_t x, int16_t y, const uint8_t icon[],
+                              int16_t size, uint16_t color);
+  virtual void drawLayer(int16_t y, const uint8_t layer[], int16_t h);
+  void replay(const std::vector<draw_cmd_t> &displayList, uint8_t rotation);
+
+  int16_t getBandY() const { return bandY; }
+
+protected:
+  void drawGlyph(int16_t x, int16_t y, uint8_t c, uint16_t color,
+                 uint8_t sizeX, uint8_t sizeY);
+
+private:
+  typedef enum plane_op
+  {
+    PLANE_KEEP,
+    PLANE_CLEAR,
+    PLANE_SET
+  } plane_op_t;
+
+  // A glyph decoded into glyphBitmaps, from offset.
+  typedef struct glyph_cache_entry
+  {
+    const GFXglyph *glyph;
+    uint16_t        offset;
+  } glyph_cache_entry_t;
+
+  bool onBand(const draw_cmd_t &cmd) const;
+  void setBits(uint32_t i, uint8_t mask, uint16_t color);
+  static void blitRow(uint8_t *dst, plane_op_t op, int16_t x,
+                      const uint8_t *src, int16_t byteWidth,
+                      int16_t i0, int16_t i1);
+  void blitPlane(uint8_t *plane, plane_op_t op, int16_t x, int16_t y,
+                 const uint8_t bitmap[], int16_t w, int16_t h);
+  void fillEdges(int n, bool evenOdd, int16_t row0, int16_t row1,
+                 uint16_t color);
+  const uint8_t *getGlyphBitmap(const GFXfont *font, const GFXglyph *glyph);
+
+  // rows [bandY, bandY + bandRows) of the display, from their first byte
+  uint8_t *bandBlack;
+  uint8_t *bandColor; // 3-color displays only
+  int16_t bandY;
+  int16_t bandRows;
+
+  // edges of the shape of a vector icon being filled, and by index those that
+  // cross the row being filled
+  std::vector<vector_edge_t> vectorEdges;
+  std::vector<uint16_t> activeEdges;
+
+  // decoded glyphs, by their entry in the glyph table
+  glyph_cache_entry_t glyphCache[FB_GLYPH_CACHE_ENTRIES];
+  uint8_t glyphBitmaps[FB_GLYPH_CACHE_BYTES];
+  uint16_t glyphBitmapsUsed;
+};
+
+/*
+ * Page buffer of the display, the band of the current page (see
+ * FramebufferBand).
+ *
+ * Drawing works like GxEPD2's paged drawing, between setFullWindow() and
+ * nextPage() returning false. When the page is the whole display it is drawn
+ * into directly. Otherwise the drawing calls are recorded in a display list,
+ * and the first call to nextPage() replays them once for each page, skipping
+ * those that fall outside of it. So the frame is only laid out once, and
+ * nextPage() returns false right away.
+ *
+ * With DRAW_IN_BANDS the calls are recorded whatever the page height, and each
+ * page is replayed in two bands at once, its upper half by this core and its
+ * lower half by a task on the other core (see bandTask), into the same page
+ * buffer. The page is sent once both are done.
+ *
+ * Given the tiles of the frame on the display, with setFrameTiles(), a
+ * black/white display that is drawn in a single page is only refreshed where
+ * tiles changed, until FULL_REFRESH_INTERVAL partial refreshes have been done.
+ */
+class Framebuffer : public FramebufferBand
+{
+public:
+  epd_panel_t panel;
+
+  Framebuffer(epd_driver_t driver);
+
+  void init(uint32_t serial_diag_bitrate = 0);
+  void init(uint32_t serial_diag_bitrate, bool initial,
+            uint16_t reset_duration = 10, bool pulldown_rst_mode = false);
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void setRotation(uint8_t r) override;
+  using Adafruit_GFX::write;
+  size_t write(uint8_t c) override;
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color) override;
+  void drawIcon(int16_t x, int16_t y, const uint8_t icon[], int16_t w,
+                int16_t h, uint16_t color) override;
+  void drawDottedHLine(int16_t x, int16_t y, int16_t w, uint8_t step,
+                       uint16_t color) override;
+  void fillDottedRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint8_t step, uint16_t color) override;
+  void drawVectorIcon(int16_t x, int16_t y, const uint8_t icon[],
+                      int16_t size, uint16_t color) override;
+  void drawLayer(int16_t y, const uint8_t layer[], int16_t h) override;
+  void setFullWindow();
+  bool nextPage();
+  void powerOff();
+  void hibernate();
+  void setFrameTiles(frame_tiles_t *tiles) { frameTiles = tiles; }
+  bool canRefreshPartially() const;
+#ifdef DRAW_IN_BANDS
+  // Draws each page on one core if false, as without DRAW_IN_BANDS.
+  void setBanded(bool b) { banded = b; }
+#endif
+
+  uint8_t *getBuffer() { return blackBuffer; }
+#ifdef DISP_3C
+  uint8_t *getColorBuffer() { return colorBuffer; }
+#endif
+  int16_t getPageY() const { return currentPage * FB_PAGE_HEIGHT; }
+  const GFXfont *getFont() const { return gfxFont; }
+
+private:
+  void record(uint8_t op, uint8_t arg, uint16_t color, int16_t x0,
+              int16_t y0, int16_t x1, int16_t y1, const void *data = NULL);
+  void setPage(uint16_t page);
+  void replayPage();
+  void writePage();
+  void refreshPanel();
+#ifdef DRAW_IN_BANDS
+  static void bandTask(void *arg);
+#endif
+
+  uint8_t blackBuffer[FB_PAGE_BYTES];
+#ifdef DISP_3C
+  uint8_t colorBuffer[FB_PAGE_BYTES];
+#endif
+  uint16_t currentPage;
+
+  std::vector<draw_cmd_t> displayList;
+  bool recording;
+  uint8_t recordingRotation;
+
+  frame_tiles_t *frameTiles;
+
+#ifdef DRAW_IN_BANDS
+  // the lower half of the page, drawn by bandTask between bandStart and
+  // bandDone
+  FramebufferBand lowerBand;
+  SemaphoreHandle_t bandStart;
+  SemaphoreHandle_t bandDone;
+  bool banded;
+#ifdef GFX_STATS
+  gfx_stats_t lowerBandStats; // the calls made drawing lowerBand
+#endif
+#endif
+};
+
+#endif
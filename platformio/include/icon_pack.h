@@ -0,0 +1,66 @@
+/* Icon pack declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2023  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ICON_PACK_H__
+#define __ICON_PACK_H__
+
+#include <cstdint>
+#include "icons/icons.h"
+
+/*
+ * The icons listed in icons/icons.h, in a flash data partition of their own,
+ * written by icons/icon_registry.py to icons.bin when building (see
+ * scripts/icon_pack.py). The partition is memory mapped, so icons are drawn
+ * straight from flash without being copied, and the application image does
+ * not include them.
+ *
+ * A pack is an icon_pack_header_t, then an icon_pack_entry_t for each icon
+ * ID, in order, then the icons. Each icon is run-length encoded as in
+ * icon_rle.h, and starts at a multiple of ICON_PACK_ALIGN bytes. All values
+ * are little-endian and the structs have no padding.
+ */
+#define ICON_PACK_MAGIC   "ICNP"
+#define ICON_PACK_VERSION 1
+#define ICON_PACK_ALIGN   4
+
+// Data partition holding the pack, see partitions_icon_pack.csv.
+#define ICON_PACK_PARTITION "icons"
+#define ICON_PACK_SUBTYPE   0x40
+
+typedef struct __attribute__((packed)) icon_pack_header
+{
+  char     magic[4];        // ICON_PACK_MAGIC, not null-terminated
+  uint16_t version;         // ICON_PACK_VERSION
+  uint16_t count;           // Number of icons, ICON_COUNT
+  uint32_t registry;        // ICON_REGISTRY_ID of the icons it was built for
+  uint32_t length;          // Length of the whole pack, bytes
+} icon_pack_header_t;
+
+typedef struct __attribute__((packed)) icon_pack_entry
+{
+  uint32_t offset;          // Start of the icon, from the start of the pack
+  uint32_t length;          // Length of the encoded icon, bytes
+  uint16_t width;           // Width, pixels
+  uint16_t height;          // Height, pixels
+} icon_pack_entry_t;
+
+bool iconPackBegin();
+const icon_pack_entry_t *getPackedIconEntry(icon_id_t id);
+const uint8_t *getPackedIcon(icon_id_t id);
+const uint8_t *getIcon(icon_id_t id);
+
+#endif
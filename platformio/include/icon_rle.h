@@ -0,0 +1,52 @@
+/* Run-length encoded icon declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2023  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ICON_RLE_H__
+#define __ICON_RLE_H__
+
+#include <cstdint>
+
+/*
+ * Icons in include/icons are run-length encoded by icons/png_to_header.py.
+ * Decoded, an icon is a bitmap in rows of (w + 7) / 8 bytes, most significant
+ * bit leftmost, with 0 for ink. Each code byte is followed by its literal
+ * bytes, if any:
+ *   0nnnnnnn  n + 1 literal bytes follow
+ *   10nnnnnn  n + 1 white bytes (0xFF)
+ *   11nnnnnn  n + 1 black bytes (0x00)
+ * Runs and literals may continue onto the next row, so an icon can only be
+ * decoded from its start, a row at a time.
+ */
+#define ICON_RLE_WHITE 0x80
+#define ICON_RLE_BLACK 0xC0
+
+/*
+ * State of decoding an icon, row by row.
+ */
+typedef struct icon_decoder
+{
+  const uint8_t *next;  // next byte of the icon, in PROGMEM
+  uint8_t        code;  // code of the current run or literal
+  uint8_t        count; // bytes left in the current run or literal
+  int16_t        inkFirst; // first byte of the last row decoded that has ink
+  int16_t        inkLast;  // last byte of the last row decoded that has ink
+} icon_decoder_t;
+
+void iconDecoderBegin(icon_decoder_t &dec, const uint8_t icon[]);
+bool iconDecodeRow(icon_decoder_t &dec, uint8_t *row, int16_t byteWidth);
+
+#endif
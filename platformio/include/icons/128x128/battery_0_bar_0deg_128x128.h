@@ -1,174 +1,69 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char battery_0_bar_0deg_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xb5, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1,
+  0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1,
+  0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1,
+  0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1,
+  0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x8b, 0x00, 0xf8, 0xc1,
+  0x00, 0x1f, 0x8a, 0x00, 0x80, 0xc3, 0x00, 0x01, 0x88, 0x00, 0xfe, 0xc5,
+  0x00, 0x7f, 0x87, 0x00, 0xfc, 0xc5, 0x00, 0x3f, 0x87, 0x00, 0xfc, 0xc5,
+  0x00, 0x3f, 0x87, 0x00, 0xf8, 0xc5, 0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5,
+  0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5, 0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5,
+  0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5, 0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5,
+  0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5,
+  0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5, 0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5,
+  0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5, 0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5,
+  0x00, 0x1f, 0x87, 0x00, 0xf8, 0xc5, 0x00, 0x1f, 0x87, 0x00, 0xfc, 0xc5,
+  0x00, 0x3f, 0x87, 0x00, 0xfc, 0xc5, 0x00, 0x3f, 0x87, 0x00, 0xfe, 0xc5,
+  0x00, 0x7f, 0x88, 0xc5, 0xbf, 0xbf, 0xb4
 };
\ No newline at end of file
@@ -1,174 +1,73 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char biological_hazard_symbol_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xbf, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-  0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-  0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xe0, 0x03, 0xff, 0xe0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xfe, 0x00,
-  0x00, 0x7f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x07, 0xf8, 0x00, 0x00, 0x1f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xc0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0, 0x00,
-  0x00, 0x03, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x01, 0xc0, 0x00, 0x00, 0x03, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xf0, 0x7f,
-  0xfe, 0x0f, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x79, 0xff, 0xff, 0x9e, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff,
-  0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x7f,
-  0xfe, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x01,
-  0x80, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x7f, 0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x07, 0xff, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x03, 0xff, 0xfc, 0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xfe, 0xfe, 0x00, 0x3f,
-  0xfc, 0x00, 0xff, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-  0xfe, 0x0f, 0x80, 0x3f, 0xfc, 0x01, 0xf0, 0x7f, 0xfc, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x7f, 0xfe, 0x07, 0xc0, 0x3f, 0xfc, 0x03, 0xe0, 0x7f,
-  0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xfe, 0x07, 0xe0, 0x3f,
-  0xfc, 0x0f, 0xe0, 0x7f, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-  0xfe, 0x07, 0xf8, 0x3f, 0xfc, 0x1f, 0xe0, 0x7f, 0xff, 0x87, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xfe, 0x07, 0xf8, 0x7f, 0xfe, 0x1f, 0xe0, 0x7f,
-  0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xfe, 0x07, 0xfd, 0xff,
-  0xff, 0xbf, 0xc0, 0x7f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-  0xfe, 0x03, 0xff, 0xcf, 0xf7, 0xff, 0xc0, 0x7f, 0xff, 0xe3, 0xff, 0xff,
-  0xff, 0xff, 0xcf, 0xff, 0xfe, 0x03, 0xff, 0x87, 0xc1, 0xff, 0xc0, 0xff,
-  0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x03, 0xff, 0x00,
-  0x00, 0xff, 0xc0, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-  0xff, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0xff, 0xff, 0xf9, 0xff, 0xff,
-  0xff, 0xff, 0x9f, 0xff, 0xff, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0xff,
-  0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x80, 0xff, 0x80,
-  0x01, 0xff, 0x01, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-  0xff, 0x80, 0xff, 0x80, 0x01, 0xfe, 0x01, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xc0, 0x7f, 0x80, 0x03, 0xfe, 0x03, 0xff,
-  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xc0, 0x3f, 0xc0,
-  0x03, 0xfc, 0x03, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-  0xff, 0xe0, 0x1f, 0xc0, 0x03, 0xf8, 0x07, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xe0, 0x0f, 0xc0, 0x03, 0xf0, 0x07, 0xff,
-  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0x07, 0xc0,
-  0x03, 0xe0, 0x0f, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-  0xff, 0xf8, 0x01, 0xc0, 0x03, 0x80, 0x1f, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xc0, 0x03, 0x80, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xc0,
-  0x03, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x01, 0x80, 0x03, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x80, 0x01, 0x81, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x80,
-  0x01, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x80, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03,
-  0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x07, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xff,
-  0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfc, 0x00, 0x3f,
-  0xf8, 0x00, 0x3f, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0xff, 0xe0, 0x00, 0x7f, 0xfe, 0x00, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x07, 0xff,
-  0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x95, 0x00, 0xfd, 0x81, 0x00, 0xbf, 0x8b,
+  0x00, 0xf7, 0x81, 0x00, 0xcf, 0x8b, 0x00, 0xcf, 0x81, 0x00, 0xf3, 0x8b,
+  0x00, 0x1f, 0x81, 0x00, 0xf8, 0x8a, 0x01, 0xfe, 0x3f, 0x81, 0x01, 0xfc,
+  0x7f, 0x89, 0x01, 0xfc, 0x7f, 0x81, 0x01, 0xfe, 0x3f, 0x89, 0x00, 0xf8,
+  0x83, 0x00, 0x1f, 0x89, 0x00, 0xf1, 0x83, 0x00, 0x8f, 0x89, 0x00, 0xe3,
+  0x83, 0x00, 0x87, 0x89, 0x00, 0xc3, 0x83, 0x00, 0xc7, 0x89, 0x00, 0xc7,
+  0x83, 0x00, 0xc3, 0x89, 0x00, 0x87, 0x83, 0x00, 0xe1, 0x89, 0x00, 0x87,
+  0x83, 0x00, 0xe1, 0x89, 0x00, 0x0f, 0x83, 0x00, 0xe0, 0x89, 0x00, 0x0f,
+  0x83, 0x00, 0xf0, 0x88, 0x01, 0xfe, 0x0f, 0x83, 0x01, 0xf0, 0x7f, 0x87,
+  0x01, 0xfe, 0x0f, 0x83, 0x01, 0xf0, 0x7f, 0x87, 0x01, 0xfe, 0x0f, 0x83,
+  0x01, 0xf0, 0x7f, 0x87, 0x01, 0xfc, 0x0f, 0x83, 0x01, 0xf0, 0x3f, 0x87,
+  0x01, 0xfc, 0x0f, 0x83, 0x01, 0xf0, 0x3f, 0x87, 0x01, 0xfc, 0x0f, 0x83,
+  0x01, 0xf0, 0x3f, 0x87, 0x01, 0xfc, 0x0f, 0x83, 0x01, 0xf0, 0x3f, 0x87,
+  0x01, 0xfc, 0x0f, 0x83, 0x01, 0xf0, 0x3f, 0x87, 0x01, 0xfc, 0x0f, 0x83,
+  0x01, 0xf0, 0x1f, 0x87, 0x07, 0xfc, 0x07, 0xff, 0xe0, 0x03, 0xff, 0xe0,
+  0x1f, 0x87, 0x02, 0xfc, 0x07, 0xfe, 0xc1, 0x02, 0x7f, 0xe0, 0x1f, 0x87,
+  0x02, 0xfc, 0x07, 0xf8, 0xc1, 0x02, 0x1f, 0xe0, 0x1f, 0x87, 0x02, 0xfc,
+  0x03, 0xe0, 0xc1, 0x02, 0x07, 0xc0, 0x3f, 0x87, 0x02, 0xfc, 0x03, 0xc0,
+  0xc1, 0x02, 0x03, 0xc0, 0x3f, 0x87, 0x02, 0xfc, 0x01, 0xc0, 0xc1, 0x02,
+  0x03, 0x80, 0x3f, 0x87, 0x07, 0xfc, 0x01, 0xe0, 0x07, 0xe0, 0x07, 0x00,
+  0x3f, 0x87, 0x07, 0xfc, 0x00, 0xf0, 0x7f, 0xfe, 0x0f, 0x00, 0x3f, 0x87,
+  0x02, 0xfe, 0x00, 0x79, 0x81, 0x02, 0x9e, 0x00, 0x7f, 0x87, 0x02, 0xfe,
+  0x00, 0x3f, 0x81, 0x02, 0xfc, 0x00, 0x7f, 0x87, 0x02, 0xfe, 0x00, 0x1f,
+  0x81, 0x02, 0xf0, 0x00, 0x7f, 0x87, 0x02, 0xe0, 0x00, 0x07, 0x81, 0x02,
+  0xe0, 0x00, 0x0f, 0x87, 0x02, 0x80, 0x00, 0x01, 0x81, 0x02, 0x80, 0x00,
+  0x01, 0x86, 0x00, 0xfe, 0xc2, 0x01, 0x7f, 0xfe, 0xc2, 0x00, 0x7f, 0x85,
+  0x00, 0xf8, 0xc2, 0x01, 0x07, 0xe0, 0xc2, 0x00, 0x1f, 0x85, 0x00, 0xf0,
+  0xc2, 0x01, 0x01, 0x80, 0xc2, 0x00, 0x0f, 0x85, 0x00, 0xc0, 0xc2, 0x01,
+  0x01, 0x80, 0xc2, 0x00, 0x03, 0x85, 0x00, 0x80, 0xc2, 0x01, 0x01, 0x80,
+  0xc2, 0x00, 0x01, 0x85, 0xc3, 0x01, 0x01, 0x80, 0xc3, 0x84, 0x00, 0xfe,
+  0xc3, 0x01, 0x07, 0xe0, 0xc3, 0x00, 0x7f, 0x83, 0x0b, 0xfc, 0x00, 0x7f,
+  0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x07, 0xff, 0x00, 0x7f, 0x83, 0x0b, 0xfc,
+  0x03, 0xff, 0xfc, 0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xff, 0xc0, 0x3f, 0x83,
+  0x0b, 0xf8, 0x0f, 0xfe, 0xfe, 0x00, 0x3f, 0xfc, 0x00, 0xff, 0x7f, 0xf0,
+  0x1f, 0x83, 0x0b, 0xf0, 0x3f, 0xfe, 0x0f, 0x80, 0x3f, 0xfc, 0x01, 0xf0,
+  0x7f, 0xfc, 0x0f, 0x83, 0x0b, 0xf0, 0x7f, 0xfe, 0x07, 0xc0, 0x3f, 0xfc,
+  0x03, 0xe0, 0x7f, 0xfe, 0x0f, 0x83, 0x0b, 0xe0, 0xff, 0xfe, 0x07, 0xe0,
+  0x3f, 0xfc, 0x0f, 0xe0, 0x7f, 0xff, 0x07, 0x83, 0x0b, 0xe1, 0xff, 0xfe,
+  0x07, 0xf8, 0x3f, 0xfc, 0x1f, 0xe0, 0x7f, 0xff, 0x87, 0x83, 0x0b, 0xc3,
+  0xff, 0xfe, 0x07, 0xf8, 0x7f, 0xfe, 0x1f, 0xe0, 0x7f, 0xff, 0xc3, 0x83,
+  0x04, 0xc7, 0xff, 0xfe, 0x07, 0xfd, 0x81, 0x04, 0xbf, 0xc0, 0x7f, 0xff,
+  0xe3, 0x83, 0x0b, 0xc7, 0xff, 0xfe, 0x03, 0xff, 0xcf, 0xf7, 0xff, 0xc0,
+  0x7f, 0xff, 0xe3, 0x83, 0x08, 0xcf, 0xff, 0xfe, 0x03, 0xff, 0x87, 0xc1,
+  0xff, 0xc0, 0x81, 0x00, 0xf1, 0x83, 0x00, 0x8f, 0x81, 0x01, 0x03, 0xff,
+  0xc1, 0x80, 0x00, 0xc0, 0x81, 0x00, 0xf9, 0x83, 0x00, 0x9f, 0x81, 0x05,
+  0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0x81, 0x00, 0xf9, 0x83, 0x00, 0x9f,
+  0x81, 0x05, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x81, 0x00, 0xf9, 0x83,
+  0x00, 0xbf, 0x81, 0x05, 0x80, 0xff, 0x80, 0x01, 0xff, 0x01, 0x81, 0x00,
+  0xfd, 0x83, 0x00, 0xbf, 0x81, 0x05, 0x80, 0xff, 0x80, 0x01, 0xfe, 0x01,
+  0x81, 0x00, 0xfd, 0x83, 0x00, 0xbf, 0x81, 0x05, 0xc0, 0x7f, 0x80, 0x03,
+  0xfe, 0x03, 0x81, 0x00, 0xfd, 0x83, 0x00, 0xbf, 0x81, 0x05, 0xc0, 0x3f,
+  0xc0, 0x03, 0xfc, 0x03, 0x81, 0x00, 0xfd, 0x83, 0x00, 0xbf, 0x81, 0x05,
+  0xe0, 0x1f, 0xc0, 0x03, 0xf8, 0x07, 0x81, 0x00, 0xfd, 0x83, 0x00, 0xbf,
+  0x81, 0x05, 0xe0, 0x0f, 0xc0, 0x03, 0xf0, 0x07, 0x81, 0x00, 0xfd, 0x83,
+  0x00, 0xbf, 0x81, 0x05, 0xf0, 0x07, 0xc0, 0x03, 0xe0, 0x0f, 0x81, 0x00,
+  0xfd, 0x83, 0x00, 0xbf, 0x81, 0x05, 0xf8, 0x01, 0xc0, 0x03, 0x80, 0x1f,
+  0x81, 0x00, 0xfd, 0x86, 0x05, 0xfc, 0x01, 0xc0, 0x03, 0x80, 0x3f, 0x89,
+  0x05, 0xfe, 0x01, 0xc0, 0x03, 0x80, 0x7f, 0x8a, 0x03, 0x01, 0x80, 0x03,
+  0x80, 0x8b, 0x03, 0xc1, 0x80, 0x01, 0x81, 0x8b, 0x03, 0xe3, 0x80, 0x01,
+  0xc7, 0x8b, 0x03, 0xfb, 0x00, 0x01, 0xdf, 0x8c, 0xc1, 0x8d, 0xc1, 0x8c,
+  0x00, 0xfe, 0xc1, 0x00, 0x7f, 0x8b, 0x00, 0xfc, 0xc1, 0x00, 0x7f, 0x8b,
+  0x00, 0xfc, 0xc1, 0x00, 0x3f, 0x8b, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x8b,
+  0x03, 0xf0, 0x01, 0x80, 0x0f, 0x8b, 0x03, 0xe0, 0x03, 0xc0, 0x07, 0x8b,
+  0x03, 0x80, 0x07, 0xe0, 0x03, 0x88, 0x00, 0xcf, 0x81, 0xc0, 0x02, 0x0f,
+  0xf0, 0x00, 0x81, 0x00, 0xf7, 0x85, 0x09, 0xf7, 0xff, 0xfc, 0x00, 0x3f,
+  0xf8, 0x00, 0x3f, 0xff, 0xcf, 0x85, 0x09, 0xf8, 0xff, 0xe0, 0x00, 0x7f,
+  0xfe, 0x00, 0x07, 0xfe, 0x3f, 0x85, 0x00, 0xfe, 0xc1, 0x00, 0x01, 0x81,
+  0xc2, 0x00, 0x7f, 0x86, 0x02, 0x80, 0x00, 0x07, 0x81, 0x02, 0xe0, 0x00,
+  0x03, 0x87, 0x02, 0xf0, 0x00, 0x3f, 0x81, 0x02, 0xfc, 0x00, 0x1f, 0xbf,
+  0xbf, 0xbf, 0xbf, 0xbf, 0x83
 };
\ No newline at end of file
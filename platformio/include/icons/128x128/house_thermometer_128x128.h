@@ -1,174 +1,80 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char house_thermometer_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xf8, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01,
-  0x80, 0x3f, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x03, 0xc0, 0x1f, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xe0, 0x0f, 0xf0, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f,
-  0xf0, 0x07, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x1f, 0xf8, 0x03, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xfc, 0x01, 0xf0, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f,
-  0xfe, 0x00, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x70, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0x80, 0x30, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff,
-  0xff, 0xc0, 0x10, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x07, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-  0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xf8,
-  0x1f, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x03, 0xff, 0xf8, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xc0,
-  0x03, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0x83, 0xc1, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0x87,
-  0xe1, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x03, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xe0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0x87,
-  0xe1, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xfc,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x87,
-  0xe1, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0xff, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xff,
-  0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0x87,
-  0xe1, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01,
-  0xff, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff,
-  0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0x86,
-  0x61, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01,
-  0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0x86,
-  0x61, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfc, 0x01, 0x01,
-  0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff, 0x80, 0x80, 0x3f, 0xff,
-  0xff, 0xfc, 0x03, 0x01, 0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff,
-  0x80, 0xc0, 0x3f, 0xff, 0xff, 0xfc, 0x07, 0x01, 0xff, 0xff, 0xff, 0x86,
-  0x61, 0xff, 0xff, 0xff, 0x80, 0xe0, 0x3f, 0xff, 0xff, 0xfe, 0x0f, 0x01,
-  0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff, 0x80, 0xf0, 0x7f, 0xff,
-  0xff, 0xff, 0x1f, 0x01, 0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff,
-  0x80, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x86,
-  0x61, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x86, 0x61, 0xff, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x86,
-  0x61, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xff, 0x06, 0x60, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfe, 0x06, 0x60, 0x7f, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0x06,
-  0x60, 0x3f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xf8, 0x1e, 0x78, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf8, 0x38, 0x1c, 0x1f, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0x70,
-  0x0e, 0x0f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xf0, 0x60, 0x07, 0x0f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0xc0, 0x07, 0x0f, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0xc0,
-  0x03, 0x0f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0xc0,
-  0x03, 0x0f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xf0, 0xc0, 0x07, 0x0f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0x60, 0x06, 0x0f, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf8, 0x70,
-  0x0e, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xf8, 0x38, 0x3c, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0x1f, 0xf8, 0x3f, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0x07,
-  0xe0, 0x3f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc0,
-  0x03, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xa6, 0x01, 0xfc, 0x3f, 0x8d, 0x01, 0xf0, 0x0f,
+  0x8d, 0x01, 0xe0, 0x07, 0x8d, 0x01, 0xc0, 0x03, 0x8d, 0x01, 0x80, 0x01,
+  0x8d, 0xc1, 0x80, 0x01, 0xfc, 0x01, 0x89, 0x00, 0xfe, 0xc1, 0x02, 0x7f,
+  0xf8, 0x00, 0x89, 0x06, 0xfc, 0x01, 0x80, 0x3f, 0xf0, 0x00, 0x7f, 0x88,
+  0x06, 0xf8, 0x03, 0xc0, 0x1f, 0xf0, 0x00, 0x7f, 0x88, 0x06, 0xf0, 0x07,
+  0xe0, 0x0f, 0xf0, 0x00, 0x7f, 0x88, 0x06, 0xe0, 0x0f, 0xf0, 0x07, 0xf0,
+  0x00, 0x7f, 0x88, 0x06, 0xc0, 0x1f, 0xf8, 0x03, 0xf0, 0x00, 0x7f, 0x88,
+  0x06, 0x80, 0x3f, 0xfc, 0x01, 0xf0, 0x00, 0x7f, 0x88, 0xc0, 0x05, 0x7f,
+  0xfe, 0x00, 0xf0, 0x00, 0x7f, 0x87, 0x01, 0xfe, 0x00, 0x81, 0xc0, 0x02,
+  0x70, 0x00, 0x7f, 0x87, 0x01, 0xfc, 0x01, 0x81, 0x03, 0x80, 0x30, 0x00,
+  0x7f, 0x87, 0x01, 0xf8, 0x03, 0x81, 0x03, 0xc0, 0x10, 0x00, 0x7f, 0x87,
+  0x01, 0xf0, 0x07, 0x81, 0x00, 0xe0, 0xc1, 0x00, 0x7f, 0x87, 0x01, 0xe0,
+  0x0f, 0x81, 0x00, 0xf0, 0xc1, 0x00, 0x7f, 0x87, 0x01, 0xc0, 0x1f, 0x81,
+  0x00, 0xf8, 0xc1, 0x00, 0x7f, 0x87, 0x01, 0x80, 0x3f, 0x81, 0x00, 0xfc,
+  0xc1, 0x00, 0x7f, 0x87, 0xc0, 0x00, 0x7f, 0x81, 0x00, 0xfe, 0xc1, 0x00,
+  0x7f, 0x86, 0x01, 0xfe, 0x00, 0x83, 0xc1, 0x00, 0x7f, 0x86, 0x01, 0xfc,
+  0x01, 0x83, 0x02, 0x80, 0x00, 0x7f, 0x86, 0x01, 0xf8, 0x03, 0x83, 0x02,
+  0xc0, 0x00, 0x7f, 0x86, 0x08, 0xf0, 0x07, 0xff, 0xf8, 0x1f, 0xff, 0xe0,
+  0x00, 0x7f, 0x86, 0x08, 0xe0, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x00,
+  0x7f, 0x86, 0x08, 0xc0, 0x1f, 0xff, 0xc0, 0x03, 0xff, 0xf8, 0x00, 0x7f,
+  0x86, 0x08, 0x80, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0x00, 0x7f, 0x86,
+  0xc0, 0x07, 0x7f, 0xff, 0x83, 0xc1, 0xff, 0xfe, 0x00, 0x7f, 0x85, 0x01,
+  0xfe, 0x00, 0x81, 0x01, 0x87, 0xe1, 0x81, 0xc0, 0x00, 0x3f, 0x85, 0x01,
+  0xfc, 0x01, 0x81, 0x01, 0x87, 0xe1, 0x81, 0x01, 0x80, 0x3f, 0x85, 0x01,
+  0xf8, 0x03, 0x81, 0x01, 0x87, 0xe1, 0x81, 0x01, 0xc0, 0x1f, 0x85, 0x01,
+  0xf0, 0x07, 0x81, 0x01, 0x87, 0xe1, 0x81, 0x01, 0xe0, 0x0f, 0x85, 0x01,
+  0xe0, 0x0f, 0x81, 0x01, 0x87, 0xe1, 0x81, 0x01, 0xf0, 0x07, 0x85, 0x01,
+  0xc0, 0x1f, 0x81, 0x01, 0x87, 0xe1, 0x81, 0x01, 0xf8, 0x03, 0x85, 0x01,
+  0x80, 0x3f, 0x81, 0x01, 0x87, 0xe1, 0x81, 0x01, 0xfc, 0x01, 0x85, 0xc0,
+  0x00, 0x7f, 0x81, 0x01, 0x87, 0xe1, 0x81, 0x01, 0xfe, 0x00, 0x84, 0x01,
+  0xfe, 0x00, 0x82, 0x01, 0x87, 0xe1, 0x82, 0xc0, 0x00, 0x7f, 0x83, 0x01,
+  0xfc, 0x01, 0x82, 0x01, 0x87, 0xe1, 0x82, 0x01, 0x80, 0x3f, 0x83, 0x01,
+  0xf8, 0x01, 0x82, 0x01, 0x87, 0xe1, 0x82, 0x01, 0x80, 0x1f, 0x83, 0x01,
+  0xf0, 0x01, 0x82, 0x01, 0x87, 0xe1, 0x82, 0x01, 0x80, 0x0f, 0x83, 0x01,
+  0xe0, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82, 0x01, 0x80, 0x07, 0x83, 0x01,
+  0xc0, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82, 0x01, 0x80, 0x03, 0x83, 0x01,
+  0x80, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82, 0x01, 0x80, 0x01, 0x83, 0xc0,
+  0x00, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82, 0x01, 0x80, 0x00, 0x82, 0x02,
+  0xfe, 0x00, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82, 0x02, 0x80, 0x00, 0x7f,
+  0x81, 0x02, 0xfc, 0x01, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82, 0x02, 0x80,
+  0x80, 0x3f, 0x81, 0x02, 0xfc, 0x03, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82,
+  0x02, 0x80, 0xc0, 0x3f, 0x81, 0x02, 0xfc, 0x07, 0x01, 0x82, 0x01, 0x86,
+  0x61, 0x82, 0x02, 0x80, 0xe0, 0x3f, 0x81, 0x02, 0xfe, 0x0f, 0x01, 0x82,
+  0x01, 0x86, 0x61, 0x82, 0x02, 0x80, 0xf0, 0x7f, 0x82, 0x01, 0x1f, 0x01,
+  0x82, 0x01, 0x86, 0x61, 0x82, 0x01, 0x80, 0xf8, 0x84, 0x00, 0x01, 0x82,
+  0x01, 0x86, 0x61, 0x82, 0x00, 0x80, 0x85, 0x00, 0x01, 0x82, 0x01, 0x86,
+  0x61, 0x82, 0x00, 0x80, 0x85, 0x00, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82,
+  0x00, 0x80, 0x85, 0x00, 0x01, 0x82, 0x01, 0x86, 0x61, 0x82, 0x00, 0x80,
+  0x85, 0x00, 0x01, 0x82, 0x01, 0x06, 0x60, 0x82, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xfe, 0x06, 0x60, 0x7f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xfc, 0x06, 0x60, 0x3f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf8, 0x1e, 0x78, 0x1f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf8, 0x38, 0x1c, 0x1f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0x70, 0x0e, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0x60, 0x07, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0xc0, 0x07, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0xc0, 0x03, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0xc0, 0x03, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0xc0, 0x03, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0xc0, 0x03, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0xc0, 0x07, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf0, 0x60, 0x06, 0x0f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf8, 0x70, 0x0e, 0x1f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xf8, 0x38, 0x3c, 0x1f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xfc, 0x1f, 0xf8, 0x3f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x03, 0xfc, 0x07, 0xe0, 0x3f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x81, 0x00, 0xfe, 0xc1, 0x00, 0x7f, 0x81, 0x00, 0x80, 0x85, 0x00,
+  0x01, 0x82, 0xc1, 0x82, 0x00, 0x80, 0x85, 0x00, 0x01, 0x82, 0x01, 0xc0,
+  0x03, 0x82, 0x00, 0x80, 0x85, 0x00, 0x01, 0x82, 0x01, 0xf0, 0x0f, 0x82,
+  0x00, 0x80, 0x85, 0x00, 0x01, 0x87, 0x00, 0x80, 0x85, 0x00, 0x01, 0x87,
+  0x00, 0x80, 0x85, 0x00, 0x01, 0x87, 0x00, 0x80, 0x85, 0x00, 0x01, 0x87,
+  0x00, 0x80, 0x85, 0x00, 0x01, 0x87, 0x00, 0x80, 0x85, 0x00, 0x01, 0x87,
+  0x00, 0x80, 0x85, 0xc0, 0x87, 0xc0, 0x85, 0x00, 0x80, 0xc7, 0x00, 0x01,
+  0x85, 0x00, 0x80, 0xc7, 0x00, 0x01, 0x85, 0x00, 0xc0, 0xc7, 0x00, 0x03,
+  0x85, 0x00, 0xc0, 0xc7, 0x00, 0x07, 0x85, 0x00, 0xe0, 0xc7, 0x00, 0x0f,
+  0x85, 0x00, 0xf8, 0xc7, 0x00, 0x1f, 0x85, 0x00, 0xfe, 0xc7, 0x00, 0x7f,
+  0xbf, 0xbf, 0xbf, 0xbf, 0xa2
 };
\ No newline at end of file
@@ -1,174 +1,61 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char wi_day_sunny_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x8f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xe0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xf8,
-  0x1f, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x01, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xf0,
-  0x0f, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x1f, 0xff, 0x00, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff,
-  0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xf8, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-  0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x3f, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xfc, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-  0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x7f, 0xc0, 0x7f, 0xff, 0xff, 0xfe, 0x03, 0xfe, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0xff, 0xff, 0xfe, 0x03, 0xfc,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0xff,
-  0xff, 0xfe, 0x03, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0x3f, 0xc0, 0x7f, 0xff, 0xff, 0xfe, 0x03, 0xfc, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0xff, 0xff, 0xfe, 0x03, 0xfc,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0xff,
-  0xff, 0xfe, 0x03, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x7f, 0xc0, 0x7f, 0xff, 0xff, 0xfe, 0x03, 0xfe, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-  0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x3f, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xf8, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-  0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xe0, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff,
-  0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f,
-  0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x00,
-  0x00, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x1f, 0xff, 0x80, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xfc, 0x3f, 0xff, 0xf0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x01, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xf8,
-  0x1f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0x96, 0x01, 0xfc, 0x3f, 0x8d, 0x01, 0xf8, 0x1f,
+  0x8d, 0x01, 0xf8, 0x1f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f,
+  0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f,
+  0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f,
+  0x8d, 0x01, 0xf0, 0x0f, 0x8a, 0x00, 0x8f, 0x81, 0x01, 0xf0, 0x0f, 0x81,
+  0x00, 0xf1, 0x87, 0x00, 0x07, 0x81, 0x01, 0xf8, 0x1f, 0x81, 0x00, 0xe0,
+  0x86, 0x01, 0xfe, 0x03, 0x81, 0x01, 0xf8, 0x1f, 0x81, 0x01, 0xc0, 0x7f,
+  0x85, 0x01, 0xfe, 0x01, 0x81, 0x01, 0xfc, 0x3f, 0x81, 0x01, 0x80, 0x7f,
+  0x85, 0x01, 0xfe, 0x00, 0x85, 0xc0, 0x00, 0x7f, 0x85, 0x02, 0xfe, 0x00,
+  0x7f, 0x83, 0x02, 0xfe, 0x00, 0x7f, 0x86, 0xc0, 0x00, 0x3f, 0x83, 0x01,
+  0xfc, 0x00, 0x87, 0x01, 0x80, 0x1f, 0x83, 0x01, 0xf8, 0x01, 0x87, 0x01,
+  0xc0, 0x0f, 0x83, 0x01, 0xf0, 0x03, 0x87, 0x01, 0xe0, 0x0f, 0x83, 0x01,
+  0xf0, 0x07, 0x87, 0x01, 0xf0, 0x0f, 0x83, 0x01, 0xf0, 0x0f, 0x87, 0x07,
+  0xf8, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x1f, 0x87, 0x07, 0xfc, 0x1f,
+  0xff, 0x00, 0x01, 0xff, 0xf8, 0x3f, 0x88, 0x01, 0x7f, 0xfc, 0xc1, 0x01,
+  0x3f, 0xfc, 0x8a, 0x00, 0xf0, 0xc1, 0x00, 0x0f, 0x8b, 0x00, 0xe0, 0xc1,
+  0x00, 0x07, 0x8b, 0x00, 0xc0, 0xc1, 0x00, 0x03, 0x8b, 0xc2, 0x00, 0x01,
+  0x8b, 0xc3, 0x8a, 0x05, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0x89, 0x05,
+  0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x89, 0x01, 0xf8, 0x01, 0x81, 0x01,
+  0x80, 0x1f, 0x89, 0x01, 0xf8, 0x03, 0x81, 0x01, 0xc0, 0x1f, 0x89, 0x01,
+  0xf0, 0x07, 0x81, 0x01, 0xe0, 0x0f, 0x89, 0x01, 0xf0, 0x0f, 0x81, 0x01,
+  0xf0, 0x0f, 0x89, 0x01, 0xe0, 0x1f, 0x81, 0x01, 0xf8, 0x07, 0x89, 0x01,
+  0xe0, 0x1f, 0x81, 0x01, 0xf8, 0x07, 0x89, 0x01, 0xe0, 0x3f, 0x81, 0x01,
+  0xfc, 0x07, 0x89, 0x01, 0xc0, 0x3f, 0x81, 0x01, 0xfc, 0x03, 0x89, 0x01,
+  0xc0, 0x3f, 0x81, 0x01, 0xfe, 0x03, 0x86, 0x04, 0xf0, 0x00, 0x7f, 0xc0,
+  0x7f, 0x81, 0x04, 0xfe, 0x03, 0xfe, 0x00, 0x0f, 0x83, 0x04, 0xe0, 0x00,
+  0x3f, 0xc0, 0x7f, 0x81, 0x04, 0xfe, 0x03, 0xfc, 0x00, 0x07, 0x83, 0x04,
+  0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0x81, 0x04, 0xfe, 0x03, 0xfc, 0x00, 0x07,
+  0x83, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0x81, 0x04, 0xfe, 0x03, 0xfc,
+  0x00, 0x07, 0x83, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0x81, 0x04, 0xfe,
+  0x03, 0xfc, 0x00, 0x07, 0x83, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x7f, 0x81,
+  0x04, 0xfe, 0x03, 0xfc, 0x00, 0x0f, 0x83, 0x04, 0xf8, 0x00, 0x7f, 0xc0,
+  0x7f, 0x81, 0x04, 0xfe, 0x03, 0xfe, 0x00, 0x1f, 0x86, 0x01, 0xc0, 0x3f,
+  0x81, 0x01, 0xfe, 0x03, 0x89, 0x01, 0xc0, 0x3f, 0x81, 0x01, 0xfc, 0x03,
+  0x89, 0x01, 0xe0, 0x3f, 0x81, 0x01, 0xfc, 0x07, 0x89, 0x01, 0xe0, 0x1f,
+  0x81, 0x01, 0xf8, 0x07, 0x89, 0x01, 0xe0, 0x1f, 0x81, 0x01, 0xf8, 0x07,
+  0x89, 0x01, 0xf0, 0x0f, 0x81, 0x01, 0xf0, 0x0f, 0x89, 0x01, 0xf0, 0x07,
+  0x81, 0x01, 0xe0, 0x0f, 0x89, 0x01, 0xf8, 0x03, 0x81, 0x01, 0xc0, 0x1f,
+  0x89, 0x01, 0xf8, 0x01, 0x81, 0x01, 0x80, 0x1f, 0x89, 0x05, 0xfc, 0x00,
+  0x7f, 0xfe, 0x00, 0x3f, 0x89, 0x05, 0xfe, 0x00, 0x1f, 0xf8, 0x00, 0x7f,
+  0x8a, 0xc3, 0x8b, 0x00, 0x80, 0xc1, 0x00, 0x01, 0x8b, 0x00, 0xc0, 0xc1,
+  0x00, 0x03, 0x8b, 0x00, 0xe0, 0xc1, 0x00, 0x07, 0x8b, 0x00, 0xf8, 0xc1,
+  0x00, 0x1f, 0x89, 0x02, 0xfe, 0x3f, 0xfc, 0xc1, 0x01, 0x7f, 0xfc, 0x88,
+  0x07, 0xfc, 0x1f, 0xff, 0x80, 0x01, 0xff, 0xf8, 0x3f, 0x87, 0x07, 0xf8,
+  0x0f, 0xff, 0xfc, 0x3f, 0xff, 0xf0, 0x1f, 0x87, 0x01, 0xf0, 0x0f, 0x83,
+  0x01, 0xf0, 0x0f, 0x87, 0x01, 0xe0, 0x0f, 0x83, 0x01, 0xf0, 0x07, 0x87,
+  0x01, 0xc0, 0x0f, 0x83, 0x01, 0xf0, 0x03, 0x87, 0x01, 0x80, 0x1f, 0x83,
+  0x01, 0xf8, 0x01, 0x87, 0xc0, 0x00, 0x3f, 0x83, 0x01, 0xfc, 0x00, 0x86,
+  0x02, 0xfe, 0x00, 0x7f, 0x83, 0x02, 0xfe, 0x00, 0x7f, 0x85, 0x01, 0xfe,
+  0x00, 0x85, 0xc0, 0x00, 0x7f, 0x85, 0x01, 0xfe, 0x01, 0x81, 0x01, 0xfc,
+  0x3f, 0x81, 0x01, 0x80, 0x7f, 0x85, 0x01, 0xfe, 0x03, 0x81, 0x01, 0xf8,
+  0x1f, 0x81, 0x01, 0xc0, 0x7f, 0x86, 0x00, 0x07, 0x81, 0x01, 0xf8, 0x1f,
+  0x81, 0x00, 0xe0, 0x8a, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d,
+  0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d,
+  0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d,
+  0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf8, 0x1f, 0x8d,
+  0x01, 0xf8, 0x1f, 0x8d, 0x01, 0xfe, 0x7f, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+  0x86
 };
\ No newline at end of file
@@ -1,174 +1,64 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char wi_day_windy_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff,
-  0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff,
-  0xff, 0xe3, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff,
-  0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-  0xf0, 0x00, 0x0f, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x1c, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xf0, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x1f, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xc0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xe0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xfc, 0x03,
-  0xff, 0xff, 0xff, 0xe0, 0x3f, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x03, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xc0, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xe0,
-  0x3f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xfe, 0x07,
-  0xff, 0xff, 0xff, 0xe0, 0x3f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xc0, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x3f, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x3f, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xfc, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x7f, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x1f, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x01, 0xe0, 0x0f, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xf0, 0x0f, 0xe0, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x0f, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x0f, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xe0, 0x07, 0xff,
-  0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x0f, 0xe0, 0x1f, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0x80, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0xc3, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0x81, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff,
-  0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x78, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0x88, 0x00, 0xe3, 0x8e, 0x00, 0x81, 0x8e, 0x00, 0x80, 0x8e, 0x00,
+  0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00,
+  0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00,
+  0x80, 0x8a, 0x00, 0xf8, 0x82, 0x00, 0x80, 0x82, 0x00, 0x1f, 0x86, 0x01,
+  0xf0, 0x3f, 0x81, 0x00, 0x80, 0x81, 0x01, 0xfe, 0x07, 0x86, 0x01, 0xe0,
+  0x1f, 0x81, 0x00, 0xc1, 0x81, 0x01, 0xfc, 0x07, 0x86, 0x01, 0xe0, 0x0f,
+  0x81, 0x00, 0xe3, 0x81, 0x01, 0xf8, 0x07, 0x86, 0x01, 0xe0, 0x07, 0x84,
+  0x01, 0xf0, 0x07, 0x86, 0x01, 0xf0, 0x03, 0x84, 0x01, 0xe0, 0x07, 0x86,
+  0x01, 0xf0, 0x01, 0x84, 0x01, 0xc0, 0x0f, 0x86, 0x01, 0xf8, 0x00, 0x84,
+  0x01, 0x80, 0x1f, 0x86, 0x01, 0xfc, 0x00, 0x84, 0x01, 0x80, 0x3f, 0x86,
+  0x01, 0xfe, 0x00, 0x84, 0xc0, 0x00, 0x7f, 0x87, 0xc0, 0x84, 0xc0, 0x88,
+  0x00, 0x80, 0x81, 0xc0, 0x02, 0x7f, 0xff, 0x81, 0x88, 0x06, 0xe1, 0xff,
+  0xf0, 0x00, 0x0f, 0xff, 0x83, 0x8a, 0x02, 0xc0, 0x00, 0x03, 0x8c, 0xc2,
+  0x8b, 0x00, 0xfe, 0xc2, 0x00, 0x3f, 0x8a, 0x00, 0xfc, 0xc2, 0x00, 0x1f,
+  0x8a, 0x00, 0xf8, 0xc2, 0x00, 0x0f, 0x8a, 0x04, 0xf0, 0x00, 0x1c, 0x00,
+  0x07, 0x8a, 0x04, 0xe0, 0x03, 0xff, 0xc0, 0x03, 0x8a, 0x04, 0xc0, 0x07,
+  0xff, 0xf0, 0x03, 0x8a, 0x04, 0x80, 0x1f, 0xff, 0xfc, 0x01, 0x8a, 0x04,
+  0x80, 0x3f, 0xff, 0xfe, 0x00, 0x8a, 0xc0, 0x00, 0x7f, 0x81, 0xc0, 0x8a,
+  0xc0, 0x82, 0x01, 0x80, 0x7f, 0x88, 0x01, 0xfe, 0x00, 0x82, 0x01, 0x80,
+  0x7f, 0x88, 0x01, 0xfe, 0x01, 0x82, 0x01, 0xc0, 0x7f, 0x88, 0x01, 0xfe,
+  0x03, 0x82, 0x01, 0xc0, 0x3f, 0x88, 0x01, 0xfe, 0x03, 0x82, 0x01, 0xe0,
+  0x3f, 0x88, 0x01, 0xfc, 0x03, 0x82, 0x01, 0xe0, 0x3f, 0x86, 0xc0, 0x02,
+  0x03, 0xfc, 0x03, 0x82, 0x03, 0xe0, 0x3f, 0xe0, 0x00, 0x84, 0xc0, 0x02,
+  0x03, 0xfc, 0x07, 0x82, 0x04, 0xe0, 0x3f, 0xc0, 0x00, 0x7f, 0x82, 0x04,
+  0xfe, 0x00, 0x01, 0xfc, 0x07, 0x82, 0x04, 0xe0, 0x3f, 0xc0, 0x00, 0x3f,
+  0x82, 0x04, 0xfe, 0x00, 0x01, 0xfe, 0x07, 0x82, 0x04, 0xe0, 0x3f, 0xc0,
+  0x00, 0x3f, 0x82, 0x02, 0xfe, 0x00, 0x01, 0x84, 0x04, 0xe0, 0x3f, 0xc0,
+  0x00, 0x7f, 0x83, 0xc0, 0x00, 0x03, 0x84, 0x04, 0xe0, 0x3f, 0xe0, 0x00,
+  0x7f, 0x83, 0x01, 0x80, 0x07, 0x84, 0x03, 0xe0, 0x3f, 0xf0, 0x00, 0x8b,
+  0x01, 0xe0, 0x3f, 0x8d, 0x01, 0xc0, 0x3f, 0x8d, 0x01, 0xc0, 0x3f, 0x8d,
+  0x01, 0xc0, 0x7f, 0x8d, 0x01, 0x80, 0x7f, 0x88, 0x01, 0xf8, 0x0f, 0x82,
+  0xc0, 0x89, 0x01, 0xe0, 0x01, 0x81, 0x01, 0xfe, 0x00, 0x89, 0x01, 0xc0,
+  0x00, 0x81, 0x01, 0xfc, 0x01, 0x89, 0x05, 0x80, 0x00, 0x7f, 0xff, 0xf8,
+  0x01, 0x89, 0xc1, 0x03, 0x3f, 0xff, 0xe0, 0x03, 0x89, 0xc1, 0x03, 0x1f,
+  0xff, 0x80, 0x07, 0x89, 0xc1, 0x03, 0x1f, 0xe0, 0x00, 0x0f, 0x89, 0x05,
+  0x01, 0xe0, 0x0f, 0xe0, 0x00, 0x1f, 0x89, 0x05, 0x83, 0xf0, 0x0f, 0xe0,
+  0x00, 0x3f, 0x8a, 0x04, 0xf8, 0x0f, 0xe0, 0x00, 0x7f, 0x8a, 0x03, 0xf8,
+  0x0f, 0xe0, 0x01, 0x8b, 0x05, 0xf8, 0x0f, 0xe0, 0x07, 0xff, 0xc7, 0x89,
+  0x05, 0xf8, 0x0f, 0xe0, 0x1f, 0xff, 0x81, 0x89, 0x01, 0xf0, 0x0f, 0x82,
+  0xc0, 0x89, 0x01, 0xf0, 0x0f, 0x82, 0xc0, 0x00, 0x7f, 0x82, 0x00, 0xc0,
+  0xc5, 0x00, 0x1f, 0x82, 0xc0, 0x00, 0x3f, 0x82, 0xc6, 0x00, 0x1f, 0x82,
+  0x01, 0x80, 0x1f, 0x81, 0x00, 0xfe, 0xc6, 0x00, 0x3f, 0x82, 0x01, 0x80,
+  0x0f, 0x81, 0x00, 0xfc, 0xc6, 0x00, 0x3f, 0x82, 0x01, 0xc0, 0x07, 0x81,
+  0x00, 0xfc, 0xc6, 0x00, 0x7f, 0x82, 0x01, 0xe0, 0x07, 0x81, 0x00, 0xfe,
+  0xc6, 0x83, 0x01, 0xf0, 0x07, 0x81, 0x00, 0xfe, 0xc5, 0x02, 0x03, 0xff,
+  0xc3, 0x81, 0x01, 0xf8, 0x07, 0x82, 0x00, 0x80, 0xc4, 0x02, 0x1f, 0xff,
+  0x81, 0x81, 0x01, 0xfc, 0x07, 0x8a, 0x00, 0x80, 0x82, 0x00, 0x0f, 0x8a,
+  0x00, 0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00, 0x80, 0x8e, 0x00, 0x80, 0x86,
+  0x00, 0xc0, 0xc1, 0x00, 0x0f, 0x83, 0x00, 0x80, 0x85, 0x00, 0xfe, 0xc3,
+  0x83, 0x00, 0x80, 0x85, 0x00, 0xfe, 0xc3, 0x00, 0x3f, 0x82, 0x00, 0x80,
+  0x85, 0x00, 0xfc, 0xc3, 0x00, 0x1f, 0x82, 0x00, 0x80, 0x85, 0x00, 0xfc,
+  0xc3, 0x00, 0x0f, 0x82, 0x00, 0x80, 0x85, 0x00, 0xfe, 0xc3, 0x00, 0x07,
+  0x82, 0x00, 0x80, 0x85, 0x00, 0xfe, 0xc3, 0x00, 0x07, 0x82, 0x00, 0x80,
+  0x86, 0x00, 0x80, 0xc2, 0x00, 0x03, 0x82, 0x00, 0xc1, 0x89, 0x01, 0xfc,
+  0x03, 0x82, 0x00, 0xf7, 0x89, 0x01, 0xfe, 0x03, 0x8d, 0x01, 0xfe, 0x03,
+  0x8d, 0x01, 0xfe, 0x03, 0x8d, 0x01, 0xfe, 0x03, 0x8d, 0x01, 0xfe, 0x03,
+  0x8c, 0x02, 0xe0, 0xfc, 0x03, 0x8c, 0x02, 0xe0, 0x78, 0x03, 0x8c, 0x02,
+  0xc0, 0x00, 0x07, 0x8c, 0x02, 0xc0, 0x00, 0x07, 0x8c, 0x02, 0xc0, 0x00,
+  0x0f, 0x8c, 0x02, 0xe0, 0x00, 0x1f, 0x8c, 0x02, 0xf0, 0x00, 0x3f, 0x8c,
+  0x02, 0xf8, 0x00, 0x7f, 0x8c, 0x01, 0xfe, 0x01, 0xbf, 0xbf, 0xbf, 0xbf,
+  0xba
 };
\ No newline at end of file
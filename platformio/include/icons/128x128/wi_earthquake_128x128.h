@@ -1,174 +1,56 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char wi_earthquake_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-  0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc1, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
-  0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x81, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
-  0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x81, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-  0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-  0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff,
-  0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x08, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff,
-  0xfe, 0x08, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x08, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x7f, 0xff, 0xfc, 0x18, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x7f, 0xc3,
-  0xfc, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x10, 0x7f, 0x83, 0xfc, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x18, 0x7f, 0x81, 0xfc, 0x18, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x18, 0x3f, 0x81,
-  0xfc, 0x38, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x18, 0x3f, 0x81, 0xf8, 0x38, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0x3f, 0x80, 0xf8, 0x38, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0x3f, 0x80,
-  0xf8, 0x38, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x38, 0x3f, 0x80, 0xf8, 0x38, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0x3f, 0x80, 0x70, 0x78, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0x3f, 0x00,
-  0x70, 0x78, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x38, 0x3f, 0x00, 0x70, 0x78, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x7c, 0x3f, 0x00, 0x30, 0x78, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7c, 0x1f, 0x00,
-  0x30, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x7c, 0x1f, 0x00, 0x00, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x7c, 0x1f, 0x04, 0x00, 0xfc, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7c, 0x1f, 0x0c,
-  0x00, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x7c, 0x1e, 0x0e, 0x00, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0xfc, 0x1e, 0x0e, 0x01, 0xfc, 0x1f, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xfc, 0x1e, 0x0e,
-  0x01, 0xfc, 0x1e, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x00, 0xfe, 0x1e, 0x0f, 0x01, 0xfc, 0x1e, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0x0e, 0x0f, 0x01, 0xfc, 0x1e, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xfe, 0x0e, 0x0f,
-  0x03, 0xfc, 0x1c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x0e, 0x0f, 0x83, 0xfc, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x1f, 0x83, 0xfc, 0x1c, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0c, 0x1f,
-  0xc3, 0xfc, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x0c, 0x1f, 0xef, 0xfc, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0c, 0x1f, 0xff, 0xfc, 0x18, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x1f,
-  0xff, 0xfc, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x04, 0x1f, 0xff, 0xfc, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x1f, 0xff, 0xfc, 0x10, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x1f,
-  0xff, 0xfc, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x04, 0x3f, 0xff, 0xfc, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f,
-  0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xfe, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
-  0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x3f, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xfe, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f,
-  0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x7f, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xfe, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f,
-  0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x7f, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xfe, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f,
-  0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-  0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x98, 0x00, 0xf0, 0x8e, 0x00, 0xf0, 0x8e,
+  0x00, 0xe0, 0x8a, 0x00, 0xe7, 0x82, 0x00, 0xe0, 0x8a, 0x00, 0xc3, 0x82,
+  0x01, 0xe0, 0x7f, 0x89, 0x00, 0xc1, 0x82, 0x01, 0xe0, 0x7f, 0x89, 0x00,
+  0xc1, 0x82, 0x01, 0xc0, 0x7f, 0x89, 0x00, 0x81, 0x82, 0x01, 0xc0, 0x7f,
+  0x89, 0x00, 0x81, 0x82, 0x01, 0xc0, 0x7f, 0x89, 0x00, 0x81, 0x82, 0x01,
+  0xc0, 0x7f, 0x89, 0x00, 0x81, 0x82, 0x01, 0xc0, 0x7f, 0x89, 0x00, 0x81,
+  0x82, 0x01, 0x80, 0x7f, 0x89, 0x00, 0x80, 0x82, 0x01, 0x80, 0x7f, 0x89,
+  0xc0, 0x82, 0x01, 0x80, 0x7f, 0x89, 0xc0, 0x82, 0x01, 0x80, 0x7f, 0x89,
+  0xc0, 0x82, 0xc0, 0x00, 0x7f, 0x89, 0xc0, 0x82, 0xc0, 0x00, 0x7f, 0x89,
+  0xc0, 0x82, 0xc0, 0x00, 0x7f, 0x89, 0xc0, 0x82, 0xc0, 0x00, 0x7f, 0x88,
+  0x01, 0xfe, 0x00, 0x82, 0xc0, 0x00, 0x7f, 0x88, 0x06, 0xfe, 0x00, 0x7f,
+  0xff, 0xfe, 0x00, 0x7f, 0x88, 0x06, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x08,
+  0x7f, 0x88, 0x06, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x08, 0x3f, 0x88, 0x06,
+  0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x08, 0x3f, 0x88, 0x06, 0xfe, 0x10, 0x7f,
+  0xff, 0xfc, 0x18, 0x3f, 0x88, 0x06, 0xfc, 0x10, 0x7f, 0xc3, 0xfc, 0x18,
+  0x3f, 0x88, 0x06, 0xfc, 0x10, 0x7f, 0x83, 0xfc, 0x18, 0x3f, 0x88, 0x06,
+  0xfc, 0x18, 0x7f, 0x81, 0xfc, 0x18, 0x3f, 0x88, 0x06, 0xfc, 0x18, 0x3f,
+  0x81, 0xfc, 0x38, 0x3f, 0x88, 0x06, 0xfc, 0x18, 0x3f, 0x81, 0xf8, 0x38,
+  0x3f, 0x88, 0x06, 0xf8, 0x38, 0x3f, 0x80, 0xf8, 0x38, 0x3f, 0x88, 0x06,
+  0xf8, 0x38, 0x3f, 0x80, 0xf8, 0x38, 0x3f, 0x88, 0x06, 0xf8, 0x38, 0x3f,
+  0x80, 0xf8, 0x38, 0x3f, 0x88, 0x06, 0xf8, 0x38, 0x3f, 0x80, 0x70, 0x78,
+  0x3f, 0x88, 0x06, 0xf8, 0x38, 0x3f, 0x00, 0x70, 0x78, 0x3f, 0x88, 0x06,
+  0xf8, 0x38, 0x3f, 0x00, 0x70, 0x78, 0x3f, 0x88, 0x06, 0xf0, 0x7c, 0x3f,
+  0x00, 0x30, 0x78, 0x3f, 0x88, 0x06, 0xf0, 0x7c, 0x1f, 0x00, 0x30, 0xf8,
+  0x3f, 0x88, 0x02, 0xf0, 0x7c, 0x1f, 0xc1, 0x01, 0xfc, 0x3f, 0x88, 0x06,
+  0xf0, 0x7c, 0x1f, 0x04, 0x00, 0xfc, 0x3f, 0x88, 0x06, 0xf0, 0x7c, 0x1f,
+  0x0c, 0x00, 0xfc, 0x3f, 0x88, 0x06, 0xf0, 0x7c, 0x1e, 0x0e, 0x00, 0xfc,
+  0x1f, 0x86, 0x00, 0xfe, 0xc1, 0x05, 0xfc, 0x1e, 0x0e, 0x01, 0xfc, 0x1f,
+  0xc1, 0x00, 0x7f, 0x83, 0x00, 0xfe, 0xc1, 0x05, 0xfc, 0x1e, 0x0e, 0x01,
+  0xfc, 0x1e, 0xc1, 0x00, 0x7f, 0x83, 0x00, 0xfc, 0xc1, 0x05, 0xfe, 0x1e,
+  0x0f, 0x01, 0xfc, 0x1e, 0xc1, 0x00, 0x7f, 0x83, 0x00, 0xfe, 0xc1, 0x05,
+  0xfe, 0x0e, 0x0f, 0x01, 0xfc, 0x1e, 0xc1, 0x00, 0x7f, 0x84, 0xc0, 0x06,
+  0x03, 0xfe, 0x0e, 0x0f, 0x03, 0xfc, 0x1c, 0xc1, 0x87, 0x06, 0xfe, 0x0e,
+  0x0f, 0x83, 0xfc, 0x1c, 0x1f, 0x88, 0x06, 0xfe, 0x0e, 0x1f, 0x83, 0xfc,
+  0x1c, 0x1f, 0x88, 0x06, 0xfe, 0x0c, 0x1f, 0xc3, 0xfc, 0x1c, 0x1f, 0x88,
+  0x06, 0xfe, 0x0c, 0x1f, 0xef, 0xfc, 0x18, 0x3f, 0x88, 0x06, 0xfe, 0x0c,
+  0x1f, 0xff, 0xfc, 0x18, 0x3f, 0x89, 0x05, 0x0c, 0x1f, 0xff, 0xfc, 0x18,
+  0x3f, 0x89, 0x05, 0x04, 0x1f, 0xff, 0xfc, 0x18, 0x3f, 0x89, 0x05, 0x04,
+  0x1f, 0xff, 0xfc, 0x10, 0x7f, 0x89, 0x05, 0x04, 0x1f, 0xff, 0xfc, 0x10,
+  0x7f, 0x89, 0x05, 0x04, 0x3f, 0xff, 0xfc, 0x10, 0x7f, 0x89, 0xc0, 0x04,
+  0x3f, 0xff, 0xfe, 0x00, 0x7f, 0x89, 0xc0, 0x03, 0x3f, 0xff, 0xfe, 0x00,
+  0x8a, 0xc0, 0x03, 0x3f, 0xff, 0xfe, 0x00, 0x8a, 0x04, 0x80, 0x3f, 0xff,
+  0xfe, 0x00, 0x8a, 0x04, 0x80, 0x3f, 0xff, 0xfe, 0x00, 0x8a, 0x04, 0x80,
+  0x3f, 0xff, 0xfe, 0x00, 0x8a, 0x04, 0x80, 0x3f, 0xff, 0xfe, 0x01, 0x8a,
+  0x04, 0x80, 0x7f, 0xff, 0xfe, 0x01, 0x8a, 0x04, 0x80, 0x7f, 0xff, 0xfe,
+  0x01, 0x8a, 0x04, 0x80, 0x7f, 0xff, 0xfe, 0x01, 0x8a, 0x04, 0x80, 0x7f,
+  0xff, 0xfe, 0x03, 0x8a, 0x04, 0xc0, 0x7f, 0xff, 0xfe, 0x03, 0x8a, 0x04,
+  0xc0, 0x7f, 0xff, 0xfe, 0x03, 0x8a, 0x04, 0xc0, 0x7f, 0xff, 0xfe, 0x03,
+  0x8a, 0x00, 0xc0, 0x81, 0x01, 0xfe, 0x07, 0x8a, 0x00, 0xc0, 0x81, 0x01,
+  0xfe, 0x07, 0x8a, 0x00, 0xc0, 0x81, 0x01, 0xfe, 0x07, 0x8a, 0x00, 0xc0,
+  0x81, 0x01, 0xfe, 0x07, 0x8a, 0x00, 0xc0, 0x82, 0x00, 0x0f, 0x8a, 0x00,
+  0xe0, 0x82, 0x00, 0x0f, 0x8a, 0x00, 0xe0, 0x82, 0x00, 0x1f, 0x8a, 0x00,
+  0xe0, 0x8e, 0x00, 0xe1, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb8
 };
\ No newline at end of file
@@ -1,174 +1,56 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char wi_humidity_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfc, 0x00,
-  0x00, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x03, 0xff, 0x00, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0x80, 0x01, 0xf0, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xc0,
-  0x03, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x1f, 0xff, 0xc0, 0x03, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xe0, 0x07, 0xe0, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0x87, 0xe0,
-  0x07, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x3f, 0x87, 0xf0, 0x0f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0x87, 0xf0, 0x0f, 0xc0, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0x87, 0xf0,
-  0x1f, 0x80, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x3f, 0x87, 0xf0, 0x1f, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0x87, 0xf0, 0x1f, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0x87, 0xf0,
-  0x3f, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x3f, 0x87, 0xf0, 0x3e, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0x87, 0xf0, 0x7e, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0x87, 0xf0,
-  0x7c, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0x87, 0xe0, 0xfc, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xcf, 0xe0, 0xf8, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xe1,
-  0xf8, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x0f, 0xff, 0xc1, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xc3, 0xf0, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0x83,
-  0xf0, 0x3f, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x01, 0xfe, 0x07, 0xe0, 0x7f, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0xe0, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07,
-  0xc1, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x0f, 0xc1, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x83, 0xf8, 0xfe, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1f,
-  0x83, 0xf8, 0x7e, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x1f, 0x03, 0xf0, 0x7e, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0x03, 0xf0, 0x7f, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3e,
-  0x03, 0xf0, 0x7f, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x7e, 0x03, 0xf0, 0x7f, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7e, 0x07, 0xf0, 0x7f, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xfc,
-  0x03, 0xf0, 0x7f, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0x00, 0xfc, 0x03, 0xf0, 0x7f, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xf8, 0x03, 0xf0, 0x7e, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xf8,
-  0x03, 0xf8, 0x7e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x01, 0xf0, 0x03, 0xf8, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xf0, 0x01, 0xff, 0xfe, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xe0,
-  0x01, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x07, 0xe0, 0x00, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0xf8, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xc0,
-  0x00, 0x3f, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x86, 0x01, 0xfe, 0x7f, 0x8d, 0x01,
+  0xfc, 0x3f, 0x8d, 0x01, 0xf0, 0x1f, 0x8d, 0x01, 0xe0, 0x0f, 0x8d, 0x01,
+  0xc0, 0x07, 0x8d, 0x01, 0x80, 0x03, 0x8d, 0xc0, 0x00, 0x01, 0x8d, 0xc1,
+  0x8c, 0x00, 0xfe, 0xc1, 0x00, 0x7f, 0x8b, 0x00, 0xfc, 0xc1, 0x00, 0x3f,
+  0x8b, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x8b, 0x00, 0xf0, 0xc1, 0x00, 0x0f,
+  0x8b, 0x00, 0xe0, 0xc1, 0x00, 0x0f, 0x8b, 0x00, 0xc0, 0xc1, 0x00, 0x07,
+  0x8b, 0x00, 0x80, 0xc1, 0x00, 0x03, 0x8b, 0x00, 0x80, 0xc1, 0x00, 0x01,
+  0x8b, 0xc3, 0x8a, 0x00, 0xfe, 0xc3, 0x00, 0x7f, 0x89, 0x00, 0xfc, 0xc3,
+  0x00, 0x7f, 0x89, 0x00, 0xf8, 0xc3, 0x00, 0x3f, 0x89, 0x00, 0xf8, 0xc3,
+  0x00, 0x1f, 0x89, 0x00, 0xf0, 0xc3, 0x00, 0x0f, 0x89, 0x00, 0xe0, 0xc3,
+  0x00, 0x07, 0x89, 0x00, 0xc0, 0xc3, 0x00, 0x07, 0x89, 0x00, 0xc0, 0xc2,
+  0x01, 0xfc, 0x03, 0x89, 0x01, 0x80, 0xfc, 0xc1, 0x01, 0xf8, 0x01, 0x89,
+  0x05, 0x03, 0xff, 0x00, 0x01, 0xf8, 0x01, 0x89, 0x05, 0x07, 0xff, 0x80,
+  0x01, 0xf0, 0x00, 0x88, 0x06, 0xfe, 0x0f, 0xff, 0xc0, 0x03, 0xf0, 0x00,
+  0x88, 0x07, 0xfe, 0x1f, 0xff, 0xc0, 0x03, 0xf0, 0x00, 0x7f, 0x87, 0x07,
+  0xfc, 0x1f, 0xff, 0xe0, 0x07, 0xe0, 0x00, 0x7f, 0x87, 0x07, 0xfc, 0x1f,
+  0x87, 0xe0, 0x07, 0xe0, 0x00, 0x3f, 0x87, 0x07, 0xf8, 0x3f, 0x87, 0xf0,
+  0x0f, 0xc0, 0x00, 0x3f, 0x87, 0x07, 0xf8, 0x3f, 0x87, 0xf0, 0x0f, 0xc0,
+  0x00, 0x1f, 0x87, 0x07, 0xf0, 0x3f, 0x87, 0xf0, 0x1f, 0x80, 0x00, 0x1f,
+  0x87, 0x07, 0xf0, 0x3f, 0x87, 0xf0, 0x1f, 0x80, 0x00, 0x0f, 0x87, 0x04,
+  0xe0, 0x3f, 0x87, 0xf0, 0x1f, 0xc1, 0x00, 0x0f, 0x87, 0x04, 0xe0, 0x3f,
+  0x87, 0xf0, 0x3f, 0xc1, 0x00, 0x07, 0x87, 0x04, 0xe0, 0x3f, 0x87, 0xf0,
+  0x3e, 0xc1, 0x00, 0x07, 0x87, 0x04, 0xc0, 0x3f, 0x87, 0xf0, 0x7e, 0xc1,
+  0x00, 0x03, 0x87, 0x04, 0xc0, 0x3f, 0x87, 0xf0, 0x7c, 0xc1, 0x00, 0x03,
+  0x87, 0x04, 0xc0, 0x3f, 0x87, 0xe0, 0xfc, 0xc1, 0x00, 0x03, 0x87, 0x04,
+  0x80, 0x1f, 0xcf, 0xe0, 0xf8, 0xc1, 0x00, 0x03, 0x87, 0x04, 0x80, 0x1f,
+  0xff, 0xe1, 0xf8, 0xc1, 0x00, 0x01, 0x87, 0x04, 0x80, 0x0f, 0xff, 0xc1,
+  0xf8, 0xc1, 0x00, 0x01, 0x87, 0x04, 0x80, 0x0f, 0xff, 0xc3, 0xf0, 0xc1,
+  0x00, 0x01, 0x87, 0xc0, 0x06, 0x07, 0xff, 0x83, 0xf0, 0x3f, 0xe0, 0x01,
+  0x87, 0xc0, 0x06, 0x01, 0xfe, 0x07, 0xe0, 0x7f, 0xf0, 0x01, 0x87, 0xc2,
+  0x04, 0x07, 0xe0, 0xff, 0xf8, 0x01, 0x87, 0xc2, 0x04, 0x07, 0xc1, 0xff,
+  0xfc, 0x01, 0x87, 0xc2, 0x04, 0x0f, 0xc1, 0xff, 0xfc, 0x01, 0x87, 0xc2,
+  0x04, 0x0f, 0x83, 0xf8, 0xfe, 0x01, 0x87, 0xc2, 0x04, 0x1f, 0x83, 0xf8,
+  0x7e, 0x01, 0x87, 0x00, 0x80, 0xc1, 0x04, 0x1f, 0x03, 0xf0, 0x7e, 0x01,
+  0x87, 0x00, 0x80, 0xc1, 0x04, 0x3f, 0x03, 0xf0, 0x7f, 0x01, 0x87, 0x00,
+  0x80, 0xc1, 0x04, 0x3e, 0x03, 0xf0, 0x7f, 0x01, 0x87, 0x00, 0x80, 0xc1,
+  0x04, 0x7e, 0x03, 0xf0, 0x7f, 0x01, 0x87, 0x00, 0x80, 0xc1, 0x04, 0x7e,
+  0x07, 0xf0, 0x7f, 0x03, 0x87, 0x00, 0xc0, 0xc1, 0x04, 0xfc, 0x03, 0xf0,
+  0x7f, 0x03, 0x87, 0x00, 0xc0, 0xc1, 0x04, 0xfc, 0x03, 0xf0, 0x7f, 0x03,
+  0x87, 0x07, 0xc0, 0x00, 0x01, 0xf8, 0x03, 0xf0, 0x7e, 0x07, 0x87, 0x07,
+  0xe0, 0x00, 0x01, 0xf8, 0x03, 0xf8, 0x7e, 0x07, 0x87, 0x07, 0xe0, 0x00,
+  0x01, 0xf0, 0x03, 0xf8, 0xfe, 0x07, 0x87, 0x07, 0xf0, 0x00, 0x03, 0xf0,
+  0x01, 0xff, 0xfe, 0x0f, 0x87, 0x07, 0xf0, 0x00, 0x03, 0xe0, 0x01, 0xff,
+  0xfc, 0x0f, 0x87, 0x07, 0xf8, 0x00, 0x07, 0xe0, 0x00, 0xff, 0xfc, 0x1f,
+  0x87, 0x07, 0xf8, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0xf8, 0x3f, 0x87, 0x07,
+  0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x3f, 0xe0, 0x3f, 0x87, 0x07, 0xfe, 0x00,
+  0x0f, 0x80, 0x00, 0x0f, 0x80, 0x7f, 0x87, 0x03, 0xfe, 0x00, 0x1f, 0x80,
+  0xc2, 0x89, 0xc4, 0x00, 0x01, 0x89, 0x00, 0x80, 0xc3, 0x00, 0x03, 0x89,
+  0x00, 0xc0, 0xc3, 0x00, 0x07, 0x89, 0x00, 0xe0, 0xc3, 0x00, 0x0f, 0x89,
+  0x00, 0xf8, 0xc3, 0x00, 0x1f, 0x89, 0x00, 0xfc, 0xc3, 0x00, 0x3f, 0x8a,
+  0xc3, 0x8b, 0x00, 0x80, 0xc1, 0x00, 0x03, 0x8b, 0x00, 0xf0, 0xc1, 0x00,
+  0x0f, 0x8b, 0x00, 0xfc, 0xc1, 0x00, 0x7f, 0x8c, 0x01, 0xe0, 0x07, 0xbf,
+  0xbf, 0xbf, 0xbf, 0xbf, 0xb6
 };
\ No newline at end of file
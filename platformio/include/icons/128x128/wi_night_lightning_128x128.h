@@ -1,174 +1,67 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char wi_night_lightning_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,
-  0x00, 0x03, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0x00, 0x03, 0xff, 0xff,
-  0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff,
-  0xe0, 0x01, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x3f, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0xff, 0xff,
-  0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff,
-  0xff, 0x00, 0x7f, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xfc, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-  0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
-  0xff, 0xc0, 0x3f, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x0f, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-  0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-  0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xfc, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f,
-  0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x07, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xfc, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x78, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x38, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x18, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff,
-  0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x7f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff,
-  0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xc0,
-  0x01, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-  0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff,
-  0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0x80,
-  0x03, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-  0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-  0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01,
-  0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xf0,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xf8, 0x00,
-  0x7f, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x01, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xfc, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xf0, 0x00,
-  0x00, 0x7f, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xfc, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xe0, 0x00,
-  0x01, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc1, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb9, 0x01, 0xe0, 0x1f, 0x8c, 0x02,
+  0xfe, 0x00, 0x01, 0x8c, 0x00, 0xf8, 0xc1, 0x00, 0x7f, 0x8b, 0x00, 0xe0,
+  0xc1, 0x00, 0x1f, 0x8b, 0x00, 0xc0, 0xc1, 0x00, 0x07, 0x88, 0x03, 0xf8,
+  0x00, 0x3f, 0x80, 0xc1, 0x00, 0x03, 0x88, 0x02, 0xc0, 0x00, 0x07, 0xc2,
+  0x00, 0x01, 0x88, 0xc3, 0x02, 0x03, 0x80, 0x00, 0x87, 0x00, 0xfc, 0xc3,
+  0x03, 0x3f, 0xf8, 0x00, 0x7f, 0x86, 0x00, 0xf8, 0xc3, 0x80, 0x02, 0xfe,
+  0x00, 0x3f, 0x86, 0x00, 0xe0, 0xc2, 0x00, 0x03, 0x81, 0xc0, 0x00, 0x3f,
+  0x86, 0x00, 0xc0, 0xc2, 0x00, 0x07, 0x81, 0x01, 0xc0, 0x1f, 0x86, 0x04,
+  0x80, 0x00, 0xff, 0x00, 0x03, 0x81, 0x01, 0xe0, 0x1f, 0x86, 0xc0, 0x03,
+  0x0f, 0xff, 0xe0, 0x01, 0x81, 0x01, 0xe0, 0x0f, 0x85, 0x05, 0xfe, 0x00,
+  0x3f, 0xff, 0xf8, 0x01, 0x81, 0x01, 0xf0, 0x0f, 0x85, 0x05, 0xfe, 0x00,
+  0x7f, 0xff, 0xfc, 0x00, 0x81, 0x01, 0xf8, 0x07, 0x85, 0x01, 0xfc, 0x00,
+  0x82, 0xc0, 0x03, 0x7f, 0xff, 0xf8, 0x07, 0x85, 0x01, 0xf8, 0x01, 0x82,
+  0x04, 0x80, 0x3f, 0xff, 0xfc, 0x07, 0x85, 0x01, 0xf8, 0x03, 0x82, 0x04,
+  0xc0, 0x3f, 0xff, 0xfc, 0x07, 0x85, 0x01, 0xf0, 0x07, 0x82, 0x04, 0xc0,
+  0x3f, 0xff, 0xfc, 0x03, 0x85, 0x01, 0xf0, 0x0f, 0x82, 0x04, 0xe0, 0x1f,
+  0xff, 0xfc, 0x03, 0x85, 0x01, 0xf0, 0x0f, 0x82, 0x04, 0xf0, 0x1f, 0xff,
+  0xfc, 0x03, 0x85, 0x01, 0xe0, 0x1f, 0x82, 0x04, 0xf0, 0x0f, 0xff, 0xfc,
+  0x03, 0x85, 0x01, 0xe0, 0x1f, 0x82, 0x04, 0xf8, 0x0f, 0xff, 0xfc, 0x03,
+  0x85, 0x01, 0xe0, 0x3f, 0x82, 0x04, 0xf8, 0x00, 0x7f, 0xfc, 0x03, 0x85,
+  0xc0, 0x00, 0x3f, 0x82, 0x04, 0xf8, 0x00, 0x07, 0xfc, 0x03, 0x84, 0x02,
+  0xfc, 0x00, 0x3f, 0x82, 0x04, 0xf8, 0x00, 0x01, 0xfc, 0x07, 0x84, 0x02,
+  0xf0, 0x00, 0x3f, 0x82, 0x00, 0xfc, 0xc1, 0x01, 0x78, 0x07, 0x84, 0x02,
+  0xe0, 0x00, 0x3f, 0x82, 0x00, 0xfc, 0xc1, 0x01, 0x38, 0x07, 0x84, 0x02,
+  0x80, 0x00, 0x7f, 0x82, 0x00, 0xfc, 0xc1, 0x01, 0x18, 0x07, 0x84, 0xc1,
+  0x00, 0x7f, 0x82, 0x00, 0xfc, 0xc2, 0x00, 0x0f, 0x83, 0x02, 0xfe, 0x00,
+  0x03, 0x84, 0x00, 0xfe, 0xc1, 0x00, 0x0f, 0x83, 0x02, 0xfe, 0x00, 0x3f,
+  0x85, 0x02, 0xe0, 0x00, 0x1f, 0x83, 0x01, 0xfc, 0x00, 0x86, 0x02, 0xf8,
+  0x00, 0x1f, 0x83, 0x01, 0xf8, 0x01, 0x86, 0x02, 0xfc, 0x00, 0x3f, 0x83,
+  0x01, 0xf8, 0x03, 0x87, 0xc0, 0x00, 0x7f, 0x83, 0x01, 0xf0, 0x07, 0x87,
+  0xc0, 0x00, 0x7f, 0x83, 0x01, 0xf0, 0x0f, 0x87, 0x01, 0x80, 0x7f, 0x83,
+  0x01, 0xe0, 0x1f, 0x87, 0x01, 0xc0, 0x7f, 0x83, 0x01, 0xe0, 0x1f, 0x87,
+  0x01, 0xc0, 0x3f, 0x83, 0x01, 0xe0, 0x3f, 0x82, 0x02, 0xf0, 0x00, 0x3f,
+  0x81, 0x01, 0xe0, 0x3f, 0x83, 0x01, 0xe0, 0x3f, 0x82, 0x02, 0xf0, 0x00,
+  0x3f, 0x81, 0x01, 0xe0, 0x3f, 0x83, 0x01, 0xe0, 0x3f, 0x82, 0x02, 0xe0,
+  0x00, 0x7f, 0x81, 0x01, 0xe0, 0x3f, 0x83, 0x01, 0xc0, 0x3f, 0x82, 0x02,
+  0xe0, 0x00, 0x7f, 0x81, 0x01, 0xf0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x82,
+  0x01, 0xe0, 0x00, 0x82, 0x01, 0xf0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x82,
+  0x01, 0xc0, 0x00, 0x82, 0x01, 0xf0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x82,
+  0x01, 0xc0, 0x01, 0x82, 0x01, 0xf0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x82,
+  0x01, 0xc0, 0x01, 0x82, 0x01, 0xe0, 0x1f, 0x83, 0x01, 0xe0, 0x3f, 0x82,
+  0x01, 0x80, 0x03, 0x82, 0x01, 0xe0, 0x3f, 0x83, 0x01, 0xe0, 0x3f, 0x82,
+  0x01, 0x80, 0x03, 0x82, 0x01, 0xe0, 0x3f, 0x83, 0x01, 0xe0, 0x1f, 0x82,
+  0xc0, 0x00, 0x07, 0x82, 0x01, 0xe0, 0x3f, 0x83, 0x01, 0xe0, 0x1f, 0x82,
+  0xc0, 0x00, 0x0f, 0x82, 0x01, 0xc0, 0x3f, 0x83, 0x01, 0xf0, 0x0f, 0x82,
+  0xc0, 0x00, 0x0f, 0x82, 0x01, 0xc0, 0x7f, 0x83, 0x01, 0xf0, 0x0f, 0x81,
+  0x02, 0xfe, 0x00, 0x1f, 0x82, 0x01, 0x80, 0x7f, 0x83, 0x01, 0xf8, 0x07,
+  0x81, 0x02, 0xfe, 0x00, 0x1f, 0x82, 0xc0, 0x00, 0x7f, 0x83, 0x01, 0xf8,
+  0x03, 0x81, 0x02, 0xfe, 0x00, 0x3f, 0x81, 0x01, 0xfe, 0x00, 0x84, 0x01,
+  0xfc, 0x01, 0x81, 0x02, 0xfc, 0x00, 0x3f, 0x81, 0x01, 0xfc, 0x01, 0x84,
+  0x06, 0xfc, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x7f, 0x81, 0x01, 0xf0, 0x01,
+  0x84, 0x06, 0xfe, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x7f, 0x81, 0x01, 0xc0,
+  0x03, 0x85, 0xc0, 0x02, 0x01, 0xff, 0xf8, 0xc1, 0x03, 0x3f, 0xfc, 0x00,
+  0x07, 0x85, 0x03, 0x80, 0x00, 0xff, 0xf8, 0xc1, 0x03, 0x3f, 0xfc, 0x00,
+  0x0f, 0x85, 0x03, 0xc0, 0x00, 0xff, 0xf0, 0xc1, 0x03, 0x7f, 0xfc, 0x00,
+  0x1f, 0x85, 0x03, 0xe0, 0x00, 0xff, 0xf0, 0xc1, 0x80, 0x02, 0xfc, 0x00,
+  0x3f, 0x85, 0x08, 0xf8, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xfc, 0x00,
+  0x86, 0x08, 0xfe, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xfc, 0x03, 0x87,
+  0x07, 0xc1, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xfc, 0x1f, 0x8a, 0x01, 0xf8,
+  0x07, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0, 0x0f, 0x8d, 0x01, 0xf0,
+  0x1f, 0x8d, 0x01, 0xe0, 0x3f, 0x8d, 0x01, 0xe0, 0x7f, 0x8d, 0x01, 0xe0,
+  0x7f, 0x8d, 0x00, 0xc0, 0x8e, 0x00, 0xc1, 0x8e, 0x00, 0xc3, 0x8e, 0x00,
+  0x83, 0x8e, 0x00, 0x87, 0x8e, 0x00, 0x8f, 0x8e, 0x00, 0x0f, 0x8e, 0x00,
+  0x1f, 0x8e, 0x00, 0x3f, 0x8e, 0x00, 0x7f, 0xbf, 0xbf, 0xbf, 0xbf, 0xa7
 };
\ No newline at end of file
@@ -1,174 +1,72 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char wi_night_rain_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,
-  0x00, 0x03, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0x00, 0x03, 0xff, 0xff,
-  0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff,
-  0xe0, 0x01, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x3f, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0xff, 0xff,
-  0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff,
-  0xff, 0x00, 0x7f, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x03, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xfc, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-  0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
-  0xff, 0xc0, 0x3f, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x0f, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-  0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-  0xff, 0xf0, 0x0f, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f,
-  0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x07, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xfc, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x7c, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x38, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x18, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0x83, 0xff,
-  0x0f, 0xfc, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-  0xff, 0xff, 0x81, 0xfe, 0x07, 0xf8, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0x01, 0xfe, 0x03, 0xf8, 0x0f, 0xff,
-  0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x01, 0xfc,
-  0x03, 0xf8, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-  0xff, 0xff, 0x01, 0xfc, 0x07, 0xf0, 0x0f, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x1f, 0xff, 0xfe, 0x01, 0xfc, 0x07, 0xf0, 0x0f, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfe, 0x01, 0xf8,
-  0x07, 0xf0, 0x1f, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-  0xff, 0xfe, 0x03, 0xf8, 0x07, 0xf0, 0x1f, 0xff, 0x80, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x07, 0xff, 0xfe, 0x03, 0xf8, 0x0f, 0xe0, 0x1f, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xfc, 0x03, 0xf8,
-  0x0f, 0xe0, 0x3f, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01,
-  0xff, 0xfc, 0x03, 0xf0, 0x0f, 0xe0, 0x3f, 0xfc, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x7f, 0xfc, 0x07, 0xf0, 0x0f, 0xe0, 0x3f, 0xf0,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xf8, 0x07, 0xf0,
-  0x1f, 0xc0, 0x3f, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x01, 0xf8, 0x07, 0xf0, 0x1f, 0xc0, 0x7c, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x01, 0xf8, 0x07, 0xe0, 0x1f, 0xc0, 0x7c, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xf8, 0x0f, 0xe0,
-  0x1f, 0xc0, 0x7c, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x01, 0xf0, 0x0f, 0xe0, 0x3f, 0x80, 0x7c, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xf0, 0x0f, 0xe0, 0x3f, 0x80, 0xfc, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xf0, 0x1f, 0xc0,
-  0x3f, 0x80, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc1, 0xf0, 0x1f, 0xc0, 0x7f, 0x00, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xc0, 0x7f, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xc0,
-  0x7f, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x3f, 0x80, 0x7f, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0x80, 0xfe, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0x80,
-  0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x3f, 0x00, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0x00, 0xfe, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0x01,
-  0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x7f, 0x01, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xfe, 0x01, 0xfe, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xfe, 0x01,
-  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb9, 0x01, 0xe0, 0x0f, 0x8c, 0x00,
+  0xfe, 0xc1, 0x8c, 0x00, 0xf8, 0xc1, 0x00, 0x3f, 0x8b, 0x00, 0xf0, 0xc1,
+  0x00, 0x0f, 0x8b, 0x00, 0xc0, 0xc1, 0x00, 0x07, 0x88, 0x03, 0xf8, 0x00,
+  0x3f, 0x80, 0xc1, 0x00, 0x03, 0x88, 0x02, 0xc0, 0x00, 0x07, 0xc2, 0x00,
+  0x01, 0x88, 0xc3, 0x00, 0x01, 0xc1, 0x87, 0x00, 0xfc, 0xc3, 0x03, 0x3f,
+  0xf8, 0x00, 0x7f, 0x86, 0x00, 0xf8, 0xc3, 0x80, 0x02, 0xfe, 0x00, 0x3f,
+  0x86, 0x00, 0xe0, 0xc2, 0x00, 0x03, 0x81, 0x01, 0x80, 0x1f, 0x86, 0x00,
+  0xc0, 0xc2, 0x00, 0x07, 0x81, 0x01, 0xc0, 0x1f, 0x86, 0x04, 0x80, 0x01,
+  0xff, 0x00, 0x03, 0x81, 0x01, 0xe0, 0x0f, 0x86, 0xc0, 0x03, 0x0f, 0xff,
+  0xe0, 0x01, 0x81, 0x01, 0xf0, 0x0f, 0x85, 0x05, 0xfe, 0x00, 0x3f, 0xff,
+  0xf8, 0x01, 0x81, 0x01, 0xf0, 0x07, 0x85, 0x05, 0xfe, 0x00, 0x7f, 0xff,
+  0xfc, 0x00, 0x81, 0x01, 0xf8, 0x07, 0x85, 0x01, 0xfc, 0x00, 0x82, 0xc0,
+  0x03, 0x7f, 0xff, 0xf8, 0x07, 0x85, 0x01, 0xf8, 0x03, 0x82, 0x04, 0x80,
+  0x7f, 0xff, 0xfc, 0x07, 0x85, 0x01, 0xf8, 0x03, 0x82, 0x04, 0xc0, 0x3f,
+  0xff, 0xfc, 0x03, 0x85, 0x01, 0xf0, 0x07, 0x82, 0x04, 0xc0, 0x3f, 0xff,
+  0xfc, 0x03, 0x85, 0x01, 0xf0, 0x0f, 0x82, 0x04, 0xe0, 0x1f, 0xff, 0xfc,
+  0x03, 0x85, 0x01, 0xf0, 0x1f, 0x82, 0x04, 0xf0, 0x1f, 0xff, 0xfc, 0x03,
+  0x85, 0x01, 0xe0, 0x1f, 0x82, 0x04, 0xf0, 0x0f, 0xff, 0xfe, 0x03, 0x85,
+  0x01, 0xe0, 0x1f, 0x82, 0x04, 0xf0, 0x0f, 0xff, 0xfc, 0x03, 0x85, 0x01,
+  0xc0, 0x3f, 0x82, 0x04, 0xf8, 0x00, 0x7f, 0xfc, 0x03, 0x85, 0xc0, 0x00,
+  0x3f, 0x82, 0x04, 0xf8, 0x00, 0x07, 0xfc, 0x03, 0x84, 0x02, 0xfc, 0x00,
+  0x3f, 0x82, 0x04, 0xf8, 0x00, 0x01, 0xfc, 0x03, 0x84, 0x02, 0xf0, 0x00,
+  0x3f, 0x82, 0x00, 0xf8, 0xc1, 0x01, 0x7c, 0x07, 0x84, 0x02, 0xe0, 0x00,
+  0x7f, 0x82, 0x00, 0xfc, 0xc1, 0x01, 0x38, 0x07, 0x84, 0x02, 0x80, 0x00,
+  0x7f, 0x82, 0x00, 0xfc, 0xc1, 0x01, 0x18, 0x07, 0x84, 0xc1, 0x00, 0x7f,
+  0x82, 0x00, 0xfc, 0xc2, 0x00, 0x07, 0x83, 0x02, 0xfe, 0x00, 0x03, 0x84,
+  0x00, 0xfe, 0xc1, 0x00, 0x0f, 0x83, 0x02, 0xfe, 0x00, 0x3f, 0x85, 0x02,
+  0xe0, 0x00, 0x0f, 0x83, 0x01, 0xfc, 0x00, 0x86, 0x02, 0xf8, 0x00, 0x1f,
+  0x83, 0x01, 0xf8, 0x01, 0x86, 0x02, 0xfc, 0x00, 0x1f, 0x83, 0x01, 0xf8,
+  0x03, 0x86, 0x02, 0xfe, 0x00, 0x3f, 0x83, 0x01, 0xf0, 0x07, 0x87, 0xc0,
+  0x00, 0x7f, 0x83, 0x01, 0xf0, 0x0f, 0x87, 0x01, 0x80, 0x7f, 0x83, 0x01,
+  0xe0, 0x1f, 0x87, 0x01, 0xc0, 0x3f, 0x83, 0x01, 0xe0, 0x1f, 0x87, 0x01,
+  0xc0, 0x3f, 0x83, 0x01, 0xe0, 0x3f, 0x87, 0x01, 0xe0, 0x3f, 0x83, 0x01,
+  0xe0, 0x3f, 0x87, 0x01, 0xe0, 0x3f, 0x83, 0x01, 0xc0, 0x3f, 0x87, 0x01,
+  0xe0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x87, 0x01, 0xe0, 0x1f, 0x83, 0x01,
+  0xc0, 0x3f, 0x87, 0x01, 0xe0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x87, 0x01,
+  0xf0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x81, 0x07, 0x83, 0xff, 0x0f, 0xfc,
+  0x1f, 0xff, 0xe0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x81, 0x07, 0x81, 0xfe,
+  0x07, 0xf8, 0x1f, 0xff, 0xe0, 0x1f, 0x83, 0x01, 0xc0, 0x3f, 0x81, 0x07,
+  0x01, 0xfe, 0x03, 0xf8, 0x0f, 0xff, 0xe0, 0x3f, 0x83, 0x01, 0xe0, 0x3f,
+  0x81, 0x07, 0x01, 0xfc, 0x03, 0xf8, 0x0f, 0xff, 0xe0, 0x3f, 0x83, 0x01,
+  0xe0, 0x1f, 0x81, 0x07, 0x01, 0xfc, 0x07, 0xf0, 0x0f, 0xff, 0xc0, 0x3f,
+  0x83, 0x0b, 0xe0, 0x1f, 0xff, 0xfe, 0x01, 0xfc, 0x07, 0xf0, 0x0f, 0xff,
+  0xc0, 0x3f, 0x83, 0x0b, 0xf0, 0x0f, 0xff, 0xfe, 0x01, 0xf8, 0x07, 0xf0,
+  0x1f, 0xff, 0x80, 0x7f, 0x83, 0x0b, 0xf0, 0x0f, 0xff, 0xfe, 0x03, 0xf8,
+  0x07, 0xf0, 0x1f, 0xff, 0x80, 0x7f, 0x83, 0x0b, 0xf0, 0x07, 0xff, 0xfe,
+  0x03, 0xf8, 0x0f, 0xe0, 0x1f, 0xff, 0x00, 0x7f, 0x83, 0x0a, 0xf8, 0x03,
+  0xff, 0xfc, 0x03, 0xf8, 0x0f, 0xe0, 0x3f, 0xfe, 0x00, 0x84, 0x0a, 0xfc,
+  0x01, 0xff, 0xfc, 0x03, 0xf0, 0x0f, 0xe0, 0x3f, 0xfc, 0x01, 0x84, 0x0a,
+  0xfc, 0x00, 0x7f, 0xfc, 0x07, 0xf0, 0x0f, 0xe0, 0x3f, 0xf0, 0x01, 0x84,
+  0x0a, 0xfe, 0x00, 0x1f, 0xf8, 0x07, 0xf0, 0x1f, 0xc0, 0x3f, 0x80, 0x03,
+  0x85, 0xc0, 0x08, 0x01, 0xf8, 0x07, 0xf0, 0x1f, 0xc0, 0x7c, 0x00, 0x07,
+  0x85, 0x09, 0x80, 0x01, 0xf8, 0x07, 0xe0, 0x1f, 0xc0, 0x7c, 0x00, 0x0f,
+  0x85, 0x09, 0xc0, 0x01, 0xf8, 0x0f, 0xe0, 0x1f, 0xc0, 0x7c, 0x00, 0x1f,
+  0x85, 0x09, 0xe0, 0x01, 0xf0, 0x0f, 0xe0, 0x3f, 0x80, 0x7c, 0x00, 0x3f,
+  0x85, 0x08, 0xf8, 0x01, 0xf0, 0x0f, 0xe0, 0x3f, 0x80, 0xfc, 0x00, 0x86,
+  0x08, 0xfe, 0x01, 0xf0, 0x1f, 0xc0, 0x3f, 0x80, 0xfc, 0x03, 0x87, 0x07,
+  0xc1, 0xf0, 0x1f, 0xc0, 0x7f, 0x00, 0xfc, 0x1f, 0x88, 0x04, 0xe0, 0x1f,
+  0xc0, 0x7f, 0x00, 0x8a, 0x04, 0xe0, 0x1f, 0xc0, 0x7f, 0x01, 0x8a, 0x04,
+  0xe0, 0x3f, 0x80, 0x7f, 0x01, 0x8a, 0x04, 0xe0, 0x3f, 0x80, 0xfe, 0x01,
+  0x8a, 0x04, 0xc0, 0x3f, 0x80, 0xfe, 0x01, 0x8a, 0x04, 0xc0, 0x3f, 0x00,
+  0xfe, 0x03, 0x8a, 0x04, 0xc0, 0x7f, 0x00, 0xfe, 0x03, 0x8a, 0x04, 0xc0,
+  0x7f, 0x01, 0xfc, 0x03, 0x8a, 0x04, 0xc0, 0x7f, 0x01, 0xfe, 0x07, 0x8a,
+  0x04, 0xc0, 0xfe, 0x01, 0xfe, 0x07, 0x8a, 0x04, 0xe1, 0xfe, 0x01, 0xff,
+  0x0f, 0x8b, 0x01, 0xfe, 0x03, 0x8d, 0x01, 0xfe, 0x03, 0x8d, 0x01, 0xfc,
+  0x03, 0x8d, 0x01, 0xfc, 0x03, 0x8d, 0x01, 0xfc, 0x07, 0x8d, 0x01, 0xfc,
+  0x07, 0x8d, 0x01, 0xf8, 0x07, 0x8d, 0x01, 0xf8, 0x0f, 0x8d, 0x01, 0xf8,
+  0x0f, 0x8d, 0x01, 0xf8, 0x0f, 0x8d, 0x01, 0xf8, 0x0f, 0x8d, 0x01, 0xf8,
+  0x1f, 0x8d, 0x01, 0xfc, 0x1f, 0xbf, 0xbf, 0xb7
 };
\ No newline at end of file
@@ -1,174 +1,81 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char wi_time_11_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xf8,
-  0x1f, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x7f, 0xff, 0xf8, 0x1f, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x80,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xf0,
-  0x1f, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x07, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf0,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xf0,
-  0x1f, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x1f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xfc,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xf0,
-  0x1f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0xff, 0xff, 0xf0, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xe0, 0x70, 0x1f, 0xff, 0xff, 0xff,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xe0, 0x70,
-  0x1f, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01,
-  0xff, 0xff, 0xc0, 0x30, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xe0, 0x10, 0x1f, 0xff, 0xff, 0xff,
-  0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xe0, 0x10,
-  0x1f, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07,
-  0xff, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xf8, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f,
-  0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xfc, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f,
-  0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf0,
-  0x1f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xfc,
-  0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xa5, 0x00, 0xfe, 0xc1, 0x00, 0x7f, 0x8b, 0x00, 0xe0,
+  0xc1, 0x00, 0x07, 0x8b, 0xc3, 0x8a, 0x00, 0xf8, 0xc3, 0x00, 0x1f, 0x89,
+  0x00, 0xe0, 0xc3, 0x00, 0x07, 0x89, 0x00, 0x80, 0xc3, 0x00, 0x01, 0x88,
+  0x00, 0xfe, 0xc5, 0x00, 0x7f, 0x87, 0x00, 0xfc, 0xc5, 0x00, 0x3f, 0x87,
+  0x00, 0xf0, 0xc5, 0x00, 0x0f, 0x87, 0x00, 0xe0, 0xc5, 0x00, 0x07, 0x87,
+  0x00, 0xc0, 0xc1, 0x01, 0x0f, 0xf8, 0xc1, 0x00, 0x03, 0x87, 0xc1, 0x00,
+  0x03, 0x81, 0x00, 0xc0, 0xc1, 0x86, 0x00, 0xfe, 0xc1, 0x00, 0x1f, 0x81,
+  0x00, 0xf8, 0xc1, 0x00, 0x7f, 0x85, 0x00, 0xfc, 0xc1, 0x00, 0x7f, 0x81,
+  0x00, 0xfe, 0xc1, 0x00, 0x3f, 0x85, 0x02, 0xf8, 0x00, 0x01, 0x83, 0x02,
+  0x80, 0x00, 0x1f, 0x85, 0x02, 0xf0, 0x00, 0x07, 0x83, 0x02, 0xe0, 0x00,
+  0x0f, 0x85, 0x09, 0xe0, 0x00, 0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0x00,
+  0x07, 0x85, 0x09, 0xe0, 0x00, 0x3f, 0xff, 0xf8, 0x1f, 0xff, 0xfc, 0x00,
+  0x07, 0x85, 0x09, 0xc0, 0x00, 0x7f, 0xff, 0xf8, 0x1f, 0xff, 0xfe, 0x00,
+  0x03, 0x85, 0x01, 0x80, 0x01, 0x81, 0x01, 0xf0, 0x1f, 0x81, 0x01, 0x80,
+  0x01, 0x85, 0xc0, 0x00, 0x03, 0x81, 0x01, 0xf0, 0x1f, 0x81, 0x01, 0xc0,
+  0x00, 0x85, 0xc0, 0x00, 0x07, 0x81, 0x01, 0xf0, 0x1f, 0x81, 0x01, 0xe0,
+  0x00, 0x84, 0x02, 0xfe, 0x00, 0x0f, 0x81, 0x01, 0xf0, 0x1f, 0x81, 0x02,
+  0xf0, 0x00, 0x7f, 0x83, 0x02, 0xfe, 0x00, 0x1f, 0x81, 0x01, 0xf0, 0x1f,
+  0x81, 0x02, 0xf8, 0x00, 0x7f, 0x83, 0x02, 0xfc, 0x00, 0x1f, 0x81, 0x01,
+  0xf0, 0x1f, 0x81, 0x02, 0xf8, 0x00, 0x3f, 0x83, 0x02, 0xf8, 0x00, 0x3f,
+  0x81, 0x01, 0xf0, 0x1f, 0x81, 0x02, 0xfc, 0x00, 0x1f, 0x83, 0x02, 0xf8,
+  0x00, 0x7f, 0x81, 0x01, 0xf0, 0x1f, 0x81, 0x02, 0xfe, 0x00, 0x1f, 0x83,
+  0x01, 0xf0, 0x00, 0x81, 0x02, 0xf0, 0xf0, 0x1f, 0x82, 0xc0, 0x00, 0x0f,
+  0x83, 0x01, 0xf0, 0x00, 0x81, 0x02, 0xe0, 0x70, 0x1f, 0x82, 0xc0, 0x00,
+  0x0f, 0x83, 0x01, 0xf0, 0x01, 0x81, 0x02, 0xe0, 0x70, 0x1f, 0x82, 0x01,
+  0x80, 0x0f, 0x83, 0x01, 0xe0, 0x01, 0x81, 0x02, 0xc0, 0x30, 0x1f, 0x82,
+  0x01, 0x80, 0x07, 0x83, 0x01, 0xe0, 0x03, 0x81, 0x02, 0xe0, 0x10, 0x1f,
+  0x82, 0x01, 0xc0, 0x07, 0x83, 0x01, 0xc0, 0x03, 0x81, 0x02, 0xe0, 0x10,
+  0x1f, 0x82, 0x01, 0xc0, 0x03, 0x83, 0x01, 0xc0, 0x07, 0x81, 0x02, 0xf0,
+  0x00, 0x1f, 0x82, 0x01, 0xe0, 0x03, 0x83, 0x01, 0xc0, 0x07, 0x81, 0x02,
+  0xf0, 0x00, 0x1f, 0x82, 0x01, 0xe0, 0x03, 0x83, 0x01, 0xc0, 0x07, 0x81,
+  0x02, 0xf8, 0x00, 0x1f, 0x82, 0x01, 0xe0, 0x03, 0x83, 0x01, 0x80, 0x0f,
+  0x81, 0x02, 0xf8, 0x00, 0x1f, 0x82, 0x01, 0xf0, 0x01, 0x83, 0x01, 0x80,
+  0x0f, 0x81, 0x02, 0xfc, 0x00, 0x1f, 0x82, 0x01, 0xf0, 0x01, 0x83, 0x01,
+  0x80, 0x0f, 0x81, 0x02, 0xfc, 0x00, 0x1f, 0x82, 0x01, 0xf0, 0x01, 0x83,
+  0x01, 0x80, 0x1f, 0x81, 0x02, 0xfe, 0x00, 0x1f, 0x82, 0x01, 0xf8, 0x01,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xf8, 0x01,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0x80, 0x1f, 0x82, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0x80, 0x1f, 0x82, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xc0, 0x1f, 0x82, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xc0, 0x1f, 0x82, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xe0, 0x1f, 0x82, 0x01, 0xfc, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xf0, 0x1f, 0x82, 0x01, 0xfc, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xf0, 0x1f, 0x82, 0x01, 0xfc, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xf8, 0x1f, 0x82, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x82, 0x01, 0xfc, 0x3f, 0x82, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f,
+  0x87, 0x01, 0xf8, 0x00, 0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00,
+  0x83, 0xc0, 0x00, 0x1f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0x01, 0x80, 0x1f,
+  0x87, 0x01, 0xf8, 0x01, 0x83, 0x01, 0x80, 0x0f, 0x87, 0x01, 0xf0, 0x01,
+  0x83, 0x01, 0x80, 0x0f, 0x87, 0x01, 0xf0, 0x01, 0x83, 0x01, 0x80, 0x0f,
+  0x87, 0x01, 0xf0, 0x01, 0x83, 0x01, 0x80, 0x0f, 0x87, 0x01, 0xf0, 0x01,
+  0x83, 0x01, 0xc0, 0x07, 0x87, 0x01, 0xe0, 0x03, 0x83, 0x01, 0xc0, 0x07,
+  0x87, 0x01, 0xe0, 0x03, 0x83, 0x01, 0xc0, 0x03, 0x87, 0x01, 0xc0, 0x03,
+  0x83, 0x01, 0xe0, 0x03, 0x87, 0x01, 0xc0, 0x07, 0x83, 0x01, 0xe0, 0x01,
+  0x87, 0x01, 0xc0, 0x07, 0x83, 0x01, 0xe0, 0x01, 0x87, 0x01, 0x80, 0x07,
+  0x83, 0x01, 0xf0, 0x00, 0x87, 0xc0, 0x00, 0x0f, 0x83, 0x01, 0xf0, 0x00,
+  0x87, 0xc0, 0x00, 0x0f, 0x83, 0x02, 0xf8, 0x00, 0x7f, 0x85, 0x02, 0xfe,
+  0x00, 0x1f, 0x83, 0x02, 0xf8, 0x00, 0x3f, 0x85, 0x02, 0xfc, 0x00, 0x1f,
+  0x83, 0x02, 0xfc, 0x00, 0x3f, 0x85, 0x02, 0xfc, 0x00, 0x3f, 0x83, 0x02,
+  0xfc, 0x00, 0x1f, 0x85, 0x02, 0xf8, 0x00, 0x3f, 0x83, 0x02, 0xfe, 0x00,
+  0x0f, 0x85, 0x02, 0xf0, 0x00, 0x7f, 0x83, 0x02, 0xfe, 0x00, 0x07, 0x85,
+  0x01, 0xe0, 0x00, 0x85, 0xc0, 0x00, 0x03, 0x85, 0x01, 0xc0, 0x00, 0x85,
+  0x01, 0x80, 0x01, 0x85, 0x01, 0x80, 0x01, 0x85, 0x01, 0xc0, 0x00, 0x85,
+  0xc0, 0x00, 0x03, 0x85, 0x02, 0xc0, 0x00, 0x7f, 0x83, 0x02, 0xfe, 0x00,
+  0x03, 0x85, 0x02, 0xe0, 0x00, 0x1f, 0x83, 0x02, 0xf8, 0x00, 0x07, 0x85,
+  0x02, 0xf0, 0x00, 0x0f, 0x83, 0x02, 0xf0, 0x00, 0x0f, 0x85, 0x02, 0xf8,
+  0x00, 0x03, 0x83, 0x02, 0xc0, 0x00, 0x1f, 0x85, 0x00, 0xfc, 0xc1, 0x83,
+  0xc1, 0x00, 0x3f, 0x85, 0x00, 0xfe, 0xc1, 0x00, 0x3f, 0x81, 0x00, 0xfc,
+  0xc1, 0x00, 0x7f, 0x86, 0xc1, 0x00, 0x07, 0x81, 0x00, 0xe0, 0xc1, 0x87,
+  0x00, 0x80, 0xc1, 0x01, 0x7f, 0xfe, 0xc1, 0x00, 0x01, 0x87, 0x00, 0xc0,
+  0xc5, 0x00, 0x03, 0x87, 0x00, 0xf0, 0xc5, 0x00, 0x0f, 0x87, 0x00, 0xf8,
+  0xc5, 0x00, 0x1f, 0x87, 0x00, 0xfe, 0xc5, 0x00, 0x7f, 0x88, 0xc5, 0x89,
+  0x00, 0xc0, 0xc3, 0x00, 0x03, 0x89, 0x00, 0xf0, 0xc3, 0x00, 0x0f, 0x89,
+  0x00, 0xfe, 0xc3, 0x00, 0x7f, 0x8a, 0x00, 0xc0, 0xc1, 0x00, 0x03, 0x8b,
+  0x00, 0xfc, 0xc1, 0x00, 0x1f, 0x8c, 0x01, 0xf0, 0x0f, 0xbf, 0xbf, 0xbf,
+  0xbf, 0xa6
 };
\ No newline at end of file
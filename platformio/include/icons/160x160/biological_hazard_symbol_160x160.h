@@ -1,270 +1,99 @@
-// 160 x 160
+// 160 x 160, run-length encoded
 const unsigned char biological_hazard_symbol_160x160[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf3, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-  0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-  0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff,
-  0xff, 0xe0, 0x07, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x7f,
-  0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f,
-  0xc0, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00,
-  0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3c,
-  0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
-  0x78, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1e, 0x00, 0x1f, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f,
-  0x00, 0xff, 0xff, 0x01, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0x87, 0xff, 0xff, 0xc3,
-  0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x03, 0xcf, 0xff, 0xff, 0xf7, 0xc0, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-  0x00, 0x0f, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x01, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x80,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xc0,
-  0x00, 0x7f, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0x9f, 0xf0, 0x00, 0x7f, 0xfe, 0x00,
-  0x0f, 0xfd, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x7f, 0xff, 0x81, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x1f, 0xc1, 0xff, 0xfe,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xfe,
-  0x00, 0xff, 0xff, 0x00, 0x7e, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x80, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xfe, 0x01, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07,
-  0xff, 0xff, 0x80, 0xff, 0x80, 0xff, 0xff, 0x01, 0xfe, 0x01, 0xff, 0xff,
-  0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x80, 0xff,
-  0xc0, 0x7f, 0xfe, 0x03, 0xfe, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0x80, 0x7f, 0xe0, 0xff, 0xff, 0x87,
-  0xfe, 0x01, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-  0xff, 0xff, 0x80, 0x7f, 0xf3, 0xff, 0xff, 0xcf, 0xfe, 0x01, 0xff, 0xff,
-  0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x80, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0x1f, 0xf1, 0xff,
-  0xfe, 0x01, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-  0xff, 0xff, 0x80, 0x3f, 0xfe, 0x07, 0xe0, 0x7f, 0xfc, 0x03, 0xff, 0xff,
-  0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-  0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xfc, 0x00, 0x00, 0x7f,
-  0xfc, 0x03, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-  0xff, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x00, 0x7f, 0xf8, 0x03, 0xff, 0xff,
-  0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xc0, 0x1f,
-  0xfe, 0x00, 0x00, 0x7f, 0xf8, 0x07, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-  0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xfe, 0x00, 0x00, 0xff,
-  0xf0, 0x07, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff,
-  0xff, 0xff, 0xe0, 0x07, 0xfe, 0x00, 0x00, 0xff, 0xe0, 0x07, 0xff, 0xff,
-  0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0x07,
-  0xff, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0x00, 0x00, 0xff,
-  0xc0, 0x0f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0x00, 0x00, 0xff, 0x80, 0x1f, 0xff, 0xff,
-  0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0xff, 0x00, 0x00, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0x00, 0x01, 0xfe,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x3f, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x0f, 0x00, 0x01, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0x00, 0x01, 0xe0,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x07, 0x00, 0x00, 0xe0, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x07, 0x00, 0x00, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0x00, 0x00, 0xe0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x0e, 0x00, 0x00, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x70,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xde, 0x00, 0x00, 0x73, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x03, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x07, 0xe0, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x7f, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xfd,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe0,
-  0x00, 0x3f, 0xf8, 0x00, 0x07, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xfe, 0x00,
-  0x01, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xc0, 0x00,
-  0x03, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x8f, 0x00, 0xf3, 0x81,
+  0x00, 0xcf, 0x8f, 0x00, 0xcf, 0x81, 0x00, 0xf3, 0x8f, 0x00, 0x3f, 0x81,
+  0x00, 0xfc, 0x8e, 0x01, 0xfc, 0x7f, 0x81, 0x01, 0xfe, 0x3f, 0x8d, 0x00,
+  0xf9, 0x83, 0x00, 0x1f, 0x8d, 0x00, 0xe3, 0x83, 0x00, 0xc7, 0x8d, 0x00,
+  0xc7, 0x83, 0x00, 0xe3, 0x8d, 0x00, 0x8f, 0x83, 0x00, 0xe1, 0x8d, 0x00,
+  0x0f, 0x83, 0x00, 0xf0, 0x8c, 0x01, 0xfe, 0x1f, 0x83, 0x01, 0xf8, 0x7f,
+  0x8b, 0x01, 0xfc, 0x3f, 0x83, 0x01, 0xfc, 0x3f, 0x8b, 0x01, 0xf8, 0x3f,
+  0x83, 0x01, 0xfc, 0x3f, 0x8b, 0x01, 0xf8, 0x7f, 0x83, 0x01, 0xfe, 0x1f,
+  0x8b, 0x01, 0xf0, 0x7f, 0x83, 0x01, 0xfe, 0x0f, 0x8b, 0x00, 0xe0, 0x84,
+  0x01, 0xfe, 0x0f, 0x8b, 0x00, 0xe0, 0x85, 0x00, 0x07, 0x8b, 0x00, 0xc0,
+  0x85, 0x00, 0x07, 0x8b, 0x00, 0xc1, 0x85, 0x00, 0x03, 0x8b, 0x00, 0xc1,
+  0x85, 0x00, 0x83, 0x8b, 0x00, 0x81, 0x85, 0x00, 0x81, 0x8b, 0x00, 0x81,
+  0x85, 0x00, 0x81, 0x8b, 0x00, 0x01, 0x85, 0x00, 0x80, 0x8b, 0x00, 0x01,
+  0x85, 0x00, 0x80, 0x8b, 0x00, 0x01, 0x85, 0x00, 0x80, 0x8b, 0x00, 0x01,
+  0x85, 0x00, 0x80, 0x8a, 0x01, 0xfe, 0x01, 0x85, 0x01, 0x80, 0x7f, 0x89,
+  0x01, 0xfe, 0x01, 0x85, 0x01, 0x80, 0x7f, 0x89, 0x01, 0xfe, 0x01, 0x85,
+  0x01, 0x80, 0x7f, 0x89, 0x01, 0xfe, 0x01, 0x85, 0x01, 0x80, 0x7f, 0x89,
+  0x01, 0xfe, 0x01, 0x85, 0x01, 0x80, 0x7f, 0x89, 0x01, 0xfe, 0x00, 0x81,
+  0x01, 0xe0, 0x07, 0x81, 0xc0, 0x00, 0x7f, 0x89, 0x03, 0xfe, 0x00, 0xff,
+  0xfe, 0xc1, 0x03, 0x7f, 0xff, 0x00, 0x7f, 0x89, 0x03, 0xfe, 0x00, 0xff,
+  0xf0, 0xc1, 0x03, 0x0f, 0xff, 0x00, 0x7f, 0x89, 0x03, 0xfe, 0x00, 0x7f,
+  0xc0, 0xc1, 0x03, 0x03, 0xfe, 0x00, 0x7f, 0x89, 0x02, 0xfe, 0x00, 0x7f,
+  0xc3, 0x02, 0xfe, 0x00, 0x7f, 0x89, 0x02, 0xfe, 0x00, 0x3e, 0xc3, 0x02,
+  0x7c, 0x00, 0x7f, 0x89, 0x02, 0xfe, 0x00, 0x3c, 0xc3, 0x02, 0x3c, 0x00,
+  0x7f, 0x89, 0x02, 0xfe, 0x00, 0x1e, 0xc3, 0x02, 0x78, 0x00, 0x7f, 0x8a,
+  0xc0, 0x06, 0x1e, 0x00, 0x1f, 0xf0, 0x00, 0xf0, 0x00, 0x8b, 0xc0, 0x01,
+  0x0f, 0x00, 0x81, 0x02, 0x01, 0xf0, 0x00, 0x8b, 0xc0, 0x01, 0x07, 0x87,
+  0x81, 0x02, 0xc3, 0xe0, 0x00, 0x8b, 0xc0, 0x01, 0x03, 0xcf, 0x81, 0x02,
+  0xf7, 0xc0, 0x00, 0x8b, 0x01, 0x80, 0x01, 0x83, 0x01, 0x80, 0x01, 0x8b,
+  0x01, 0x80, 0x00, 0x82, 0x02, 0xfe, 0x00, 0x01, 0x8a, 0x00, 0xf8, 0xc1,
+  0x00, 0x3f, 0x81, 0x00, 0xfc, 0xc1, 0x00, 0x1f, 0x89, 0x00, 0xc0, 0xc1,
+  0x00, 0x0f, 0x81, 0x00, 0xf0, 0xc1, 0x00, 0x03, 0x89, 0xc2, 0x00, 0x03,
+  0x81, 0x00, 0xc0, 0xc2, 0x88, 0x00, 0xfc, 0xc3, 0x80, 0x00, 0xfe, 0xc3,
+  0x00, 0x3f, 0x87, 0x00, 0xf0, 0xc3, 0x01, 0x07, 0xe0, 0xc3, 0x00, 0x0f,
+  0x87, 0x00, 0xe0, 0xc3, 0x01, 0x03, 0x80, 0xc3, 0x00, 0x07, 0x87, 0x00,
+  0x80, 0xc3, 0x01, 0x03, 0x80, 0xc3, 0x00, 0x01, 0x87, 0xc4, 0x01, 0x03,
+  0x80, 0xc4, 0x86, 0x00, 0xfe, 0xc4, 0x01, 0x03, 0xc0, 0xc4, 0x00, 0x7f,
+  0x85, 0x00, 0xfc, 0xc4, 0x01, 0x03, 0xc0, 0xc4, 0x00, 0x3f, 0x85, 0x00,
+  0xf8, 0xc4, 0x01, 0x07, 0xe0, 0xc4, 0x00, 0x1f, 0x85, 0x03, 0xf0, 0x00,
+  0x1f, 0xf0, 0xc1, 0x01, 0x1f, 0xf8, 0xc1, 0x03, 0x0f, 0xfc, 0x00, 0x0f,
+  0x85, 0x03, 0xf0, 0x01, 0xff, 0xfe, 0xc1, 0x01, 0x3f, 0xfc, 0xc1, 0x81,
+  0x01, 0x80, 0x0f, 0x85, 0x01, 0xe0, 0x07, 0x81, 0x05, 0xc0, 0x00, 0x7f,
+  0xfe, 0x00, 0x03, 0x81, 0x01, 0xf0, 0x07, 0x85, 0x0d, 0xc0, 0x1f, 0xff,
+  0x9f, 0xf0, 0x00, 0x7f, 0xfe, 0x00, 0x0f, 0xfd, 0xff, 0xfc, 0x03, 0x85,
+  0x0d, 0xc0, 0x7f, 0xff, 0x81, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x1f, 0xc1,
+  0xff, 0xfe, 0x03, 0x85, 0x00, 0x80, 0x81, 0x02, 0x80, 0xfe, 0x00, 0x81,
+  0xc0, 0x01, 0x7e, 0x01, 0x81, 0x00, 0x01, 0x85, 0x00, 0x03, 0x81, 0x02,
+  0x80, 0xff, 0x00, 0x81, 0xc0, 0x01, 0xfe, 0x01, 0x81, 0x00, 0xc0, 0x85,
+  0x00, 0x07, 0x81, 0x02, 0x80, 0xff, 0x80, 0x81, 0x02, 0x01, 0xfe, 0x01,
+  0x81, 0x00, 0xe0, 0x85, 0x00, 0x0f, 0x81, 0x07, 0x80, 0xff, 0xc0, 0x7f,
+  0xfe, 0x03, 0xfe, 0x01, 0x81, 0x00, 0xf0, 0x84, 0x01, 0xfe, 0x0f, 0x81,
+  0x02, 0x80, 0x7f, 0xe0, 0x81, 0x02, 0x87, 0xfe, 0x01, 0x81, 0x01, 0xf8,
+  0x7f, 0x83, 0x01, 0xfe, 0x1f, 0x81, 0x02, 0x80, 0x7f, 0xf3, 0x81, 0x02,
+  0xcf, 0xfe, 0x01, 0x81, 0x01, 0xf8, 0x7f, 0x83, 0x01, 0xfc, 0x3f, 0x81,
+  0x01, 0x80, 0x7f, 0x83, 0x01, 0xfe, 0x01, 0x81, 0x01, 0xfc, 0x3f, 0x83,
+  0x01, 0xfc, 0x7f, 0x81, 0x07, 0x80, 0x7f, 0xff, 0x1f, 0xf1, 0xff, 0xfe,
+  0x01, 0x81, 0x01, 0xfe, 0x3f, 0x83, 0x01, 0xfc, 0x7f, 0x81, 0x07, 0x80,
+  0x3f, 0xfe, 0x07, 0xe0, 0x7f, 0xfc, 0x03, 0x81, 0x01, 0xfe, 0x3f, 0x83,
+  0x00, 0xfc, 0x82, 0x02, 0xc0, 0x3f, 0xfc, 0xc1, 0x02, 0x3f, 0xfc, 0x03,
+  0x82, 0x00, 0x3f, 0x83, 0x00, 0xf8, 0x82, 0x02, 0xc0, 0x3f, 0xfc, 0xc1,
+  0x02, 0x7f, 0xfc, 0x03, 0x82, 0x00, 0x1f, 0x83, 0x00, 0xf8, 0x82, 0x02,
+  0xc0, 0x1f, 0xfc, 0xc1, 0x02, 0x7f, 0xf8, 0x03, 0x82, 0x00, 0x1f, 0x83,
+  0x00, 0xf9, 0x82, 0x02, 0xc0, 0x1f, 0xfe, 0xc1, 0x02, 0x7f, 0xf8, 0x07,
+  0x82, 0x00, 0x9f, 0x83, 0x00, 0xf9, 0x82, 0x02, 0xe0, 0x0f, 0xfe, 0xc1,
+  0x80, 0x01, 0xf0, 0x07, 0x82, 0x00, 0x9f, 0x83, 0x00, 0xf9, 0x82, 0x02,
+  0xe0, 0x07, 0xfe, 0xc1, 0x80, 0x01, 0xe0, 0x07, 0x82, 0x00, 0x9f, 0x83,
+  0x00, 0xfb, 0x82, 0x02, 0xf0, 0x07, 0xff, 0xc1, 0x80, 0x01, 0xe0, 0x0f,
+  0x82, 0x00, 0xdf, 0x83, 0x00, 0xfb, 0x82, 0x02, 0xf0, 0x03, 0xff, 0xc1,
+  0x80, 0x01, 0xc0, 0x0f, 0x82, 0x00, 0xdf, 0x83, 0x00, 0xfb, 0x82, 0x02,
+  0xf8, 0x01, 0xff, 0xc1, 0x80, 0x01, 0x80, 0x1f, 0x82, 0x00, 0xdf, 0x83,
+  0x00, 0xfb, 0x82, 0x02, 0xfc, 0x00, 0xff, 0xc1, 0x80, 0xc0, 0x00, 0x3f,
+  0x82, 0x00, 0xdf, 0x83, 0x00, 0xfb, 0x82, 0x07, 0xfc, 0x00, 0x7f, 0x00,
+  0x01, 0xfe, 0x00, 0x3f, 0x82, 0x00, 0xdf, 0x83, 0x00, 0xfb, 0x82, 0x07,
+  0xfe, 0x00, 0x3f, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0x82, 0x00, 0xdf, 0x83,
+  0x00, 0xfb, 0x83, 0xc0, 0x04, 0x0f, 0x00, 0x01, 0xf0, 0x00, 0x83, 0x00,
+  0xdf, 0x83, 0x00, 0xfb, 0x83, 0x05, 0x80, 0x07, 0x00, 0x01, 0xe0, 0x01,
+  0x8d, 0x01, 0xc0, 0x07, 0xc1, 0x01, 0xe0, 0x03, 0x8d, 0x01, 0xe0, 0x07,
+  0xc1, 0x01, 0xe0, 0x07, 0x8d, 0x01, 0xf0, 0x07, 0xc1, 0x01, 0xe0, 0x0f,
+  0x8d, 0x01, 0xf8, 0x0f, 0xc1, 0x01, 0xf0, 0x1f, 0x8d, 0x01, 0xfe, 0x0e,
+  0xc1, 0x01, 0xf0, 0x3f, 0x8e, 0x00, 0x0e, 0xc1, 0x00, 0x70, 0x8f, 0x00,
+  0xde, 0xc1, 0x00, 0x73, 0x8f, 0x00, 0xfc, 0xc1, 0x00, 0x7f, 0x8f, 0x00,
+  0xfc, 0xc1, 0x00, 0x3f, 0x8f, 0x00, 0xf8, 0xc1, 0x00, 0x3f, 0x8f, 0x00,
+  0xf8, 0xc1, 0x00, 0x1f, 0x8f, 0x00, 0xf0, 0xc1, 0x00, 0x0f, 0x8f, 0x00,
+  0xe0, 0xc1, 0x00, 0x0f, 0x8f, 0x00, 0xe0, 0xc1, 0x00, 0x07, 0x8f, 0x00,
+  0xc0, 0xc1, 0x00, 0x03, 0x8f, 0x03, 0x80, 0x01, 0x80, 0x01, 0x8f, 0xc0,
+  0x02, 0x03, 0xc0, 0x00, 0x8a, 0x00, 0xfe, 0x82, 0x05, 0xfc, 0x00, 0x07,
+  0xe0, 0x00, 0x7f, 0x8a, 0x00, 0x7f, 0x81, 0x05, 0xf8, 0x00, 0x1f, 0xf0,
+  0x00, 0x1f, 0x81, 0x00, 0xfd, 0x87, 0x00, 0xdf, 0x81, 0x05, 0xe0, 0x00,
+  0x3f, 0xf8, 0x00, 0x07, 0x81, 0x00, 0xf3, 0x87, 0x00, 0xe7, 0x81, 0x05,
+  0x80, 0x00, 0x7f, 0xfe, 0x00, 0x01, 0x81, 0x00, 0xc7, 0x87, 0x04, 0xf0,
+  0xff, 0xfe, 0x00, 0x01, 0x81, 0xc1, 0x02, 0x7f, 0xff, 0x1f, 0x87, 0x04,
+  0xfc, 0x07, 0xc0, 0x00, 0x03, 0x81, 0x04, 0xc0, 0x00, 0x01, 0xc0, 0x7f,
+  0x88, 0xc2, 0x00, 0x0f, 0x81, 0x00, 0xf0, 0xc1, 0x00, 0x01, 0x89, 0x00,
+  0xc0, 0xc1, 0x00, 0x7f, 0x81, 0x00, 0xfc, 0xc1, 0x00, 0x07, 0x89, 0x02,
+  0xfc, 0x00, 0x03, 0x83, 0x02, 0xc0, 0x00, 0x3f, 0x8a, 0x00, 0xfb, 0xbf,
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xac
 };
\ No newline at end of file
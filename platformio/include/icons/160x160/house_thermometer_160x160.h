@@ -1,270 +1,116 @@
-// 160 x 160
+// 160 x 160, run-length encoded
 const unsigned char house_thermometer_160x160[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f,
-  0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x80, 0x0f, 0xff, 0x80, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x03, 0xc0, 0x07, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xe0, 0x03,
-  0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xf0, 0x01, 0xff, 0x80, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x1f, 0xf8, 0x00, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xfc, 0x00,
-  0x7f, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0x80, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0xff, 0xff, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0x80,
-  0x0f, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xc0, 0x07, 0x80, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x07, 0xff, 0xff, 0xe0, 0x03, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xf0,
-  0x01, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x80, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-  0xff, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x01, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x80, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x0f, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff,
-  0xff, 0x03, 0xc0, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x07, 0xe0, 0x7f,
-  0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x7f, 0xff, 0xfe, 0x07, 0xe0, 0x7f, 0xff, 0xfe, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f,
-  0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x03, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xc0, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff,
-  0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f,
-  0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x1f, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xf8, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff,
-  0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f,
-  0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff,
-  0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f,
-  0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x03, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x0e, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x04, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f,
-  0xff, 0xff, 0xff, 0xc0, 0x20, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0c,
-  0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-  0x30, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x38, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x3c, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f,
-  0xff, 0xff, 0xff, 0xc0, 0x3c, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7c,
-  0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-  0x3e, 0x03, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x0e, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xfc, 0x0e, 0x70, 0x3f,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xf8, 0x0e, 0x70, 0x1f, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xf0, 0x0e, 0x70, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x3e, 0x7c, 0x07,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0x3e, 0x03, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xc0, 0xf0, 0x0f, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xc1, 0xe0, 0x07, 0x83,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0x81, 0xc0, 0x03, 0x81, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0x83, 0x80, 0x01, 0xc1, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xc1,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0x83, 0x00, 0x01, 0xc1, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0x83, 0x00, 0x01, 0xc1, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x83, 0x00, 0x01, 0xc1,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0x83, 0x00, 0x01, 0xc1, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0x83, 0x80, 0x01, 0xc1, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x81, 0x80, 0x01, 0xc1,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0x81, 0xc0, 0x03, 0x81, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xc0, 0xe0, 0x07, 0x83, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xc0, 0xf0, 0x0f, 0x03,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xe0, 0x7e, 0x7e, 0x07, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xe0, 0x1f, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xe0, 0x0f,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x94, 0x01, 0xf0, 0x0f, 0x91,
+  0x01, 0xe0, 0x07, 0x91, 0x01, 0xc0, 0x03, 0x91, 0x01, 0x80, 0x01, 0x91,
+  0xc1, 0x90, 0x00, 0xfe, 0xc1, 0x00, 0x7f, 0x8f, 0x00, 0xfc, 0xc1, 0x03,
+  0x3f, 0xff, 0xf0, 0x01, 0x8c, 0x00, 0xf8, 0xc1, 0x04, 0x1f, 0xff, 0xc0,
+  0x00, 0x7f, 0x8b, 0x07, 0xf0, 0x01, 0x80, 0x0f, 0xff, 0x80, 0x00, 0x7f,
+  0x8b, 0x07, 0xe0, 0x03, 0xc0, 0x07, 0xff, 0x80, 0x00, 0x3f, 0x8b, 0x07,
+  0xc0, 0x07, 0xe0, 0x03, 0xff, 0x80, 0x00, 0x3f, 0x8b, 0x07, 0x80, 0x0f,
+  0xf0, 0x01, 0xff, 0x80, 0x00, 0x3f, 0x8b, 0xc0, 0x06, 0x1f, 0xf8, 0x00,
+  0xff, 0x80, 0x00, 0x3f, 0x8a, 0x08, 0xfe, 0x00, 0x3f, 0xfc, 0x00, 0x7f,
+  0x80, 0x00, 0x3f, 0x8a, 0x08, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0x80,
+  0x00, 0x3f, 0x8a, 0x01, 0xf8, 0x00, 0x81, 0xc0, 0x03, 0x1f, 0x80, 0x00,
+  0x3f, 0x8a, 0x01, 0xf0, 0x01, 0x81, 0x04, 0x80, 0x0f, 0x80, 0x00, 0x3f,
+  0x8a, 0x01, 0xe0, 0x03, 0x81, 0x04, 0xc0, 0x07, 0x80, 0x00, 0x3f, 0x8a,
+  0x01, 0xc0, 0x07, 0x81, 0x04, 0xe0, 0x03, 0x80, 0x00, 0x3f, 0x8a, 0x01,
+  0x80, 0x0f, 0x81, 0x04, 0xf0, 0x01, 0x80, 0x00, 0x3f, 0x8a, 0xc0, 0x00,
+  0x1f, 0x81, 0x04, 0xf8, 0x00, 0x80, 0x00, 0x3f, 0x89, 0x02, 0xfe, 0x00,
+  0x3f, 0x81, 0x00, 0xfc, 0xc2, 0x00, 0x3f, 0x89, 0x02, 0xfc, 0x00, 0x7f,
+  0x81, 0x00, 0xfe, 0xc2, 0x00, 0x3f, 0x89, 0x01, 0xf8, 0x00, 0x83, 0xc2,
+  0x00, 0x3f, 0x89, 0x01, 0xf0, 0x01, 0x83, 0x00, 0x80, 0xc1, 0x00, 0x3f,
+  0x89, 0x01, 0xe0, 0x03, 0x83, 0x00, 0xc0, 0xc1, 0x00, 0x3f, 0x89, 0x01,
+  0xc0, 0x07, 0x83, 0x00, 0xe0, 0xc1, 0x00, 0x3f, 0x89, 0x01, 0x80, 0x0f,
+  0x83, 0x00, 0xf0, 0xc1, 0x00, 0x3f, 0x89, 0xc0, 0x00, 0x1f, 0x83, 0x00,
+  0xf8, 0xc1, 0x00, 0x3f, 0x88, 0x02, 0xfe, 0x00, 0x3f, 0x83, 0x00, 0xfc,
+  0xc1, 0x00, 0x3f, 0x88, 0x07, 0xfc, 0x00, 0x7f, 0xff, 0xfe, 0x7f, 0xff,
+  0xfe, 0xc1, 0x00, 0x3f, 0x88, 0x01, 0xf8, 0x00, 0x81, 0x01, 0xf0, 0x0f,
+  0x81, 0xc1, 0x00, 0x3f, 0x88, 0x01, 0xf0, 0x01, 0x81, 0x01, 0xc0, 0x03,
+  0x81, 0x02, 0x80, 0x00, 0x3f, 0x88, 0x01, 0xe0, 0x03, 0x81, 0x01, 0x80,
+  0x01, 0x81, 0x02, 0xc0, 0x00, 0x3f, 0x88, 0x01, 0xc0, 0x07, 0x81, 0x01,
+  0x80, 0x01, 0x81, 0x02, 0xe0, 0x00, 0x3f, 0x88, 0x01, 0x80, 0x0f, 0x81,
+  0xc1, 0x81, 0x02, 0xf0, 0x00, 0x3f, 0x88, 0xc0, 0x00, 0x1f, 0x81, 0x01,
+  0x03, 0xc0, 0x81, 0x02, 0xf8, 0x00, 0x3f, 0x87, 0x02, 0xfe, 0x00, 0x3f,
+  0x81, 0x06, 0x07, 0xe0, 0x7f, 0xff, 0xfc, 0x00, 0x3f, 0x87, 0x0b, 0xfc,
+  0x00, 0x7f, 0xff, 0xfe, 0x07, 0xe0, 0x7f, 0xff, 0xfe, 0x00, 0x3f, 0x87,
+  0x01, 0xf8, 0x00, 0x81, 0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x81, 0xc0, 0x00,
+  0x1f, 0x87, 0x01, 0xf0, 0x01, 0x81, 0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x81,
+  0x01, 0x80, 0x0f, 0x87, 0x01, 0xe0, 0x03, 0x81, 0x03, 0xfe, 0x0f, 0xf0,
+  0x7f, 0x81, 0x01, 0xc0, 0x07, 0x87, 0x01, 0xc0, 0x07, 0x81, 0x03, 0xfe,
+  0x0f, 0xf0, 0x7f, 0x81, 0x01, 0xe0, 0x03, 0x87, 0x01, 0x80, 0x0f, 0x81,
+  0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x81, 0x01, 0xf0, 0x01, 0x87, 0xc0, 0x00,
+  0x1f, 0x81, 0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x81, 0x01, 0xf8, 0x00, 0x86,
+  0x02, 0xfe, 0x00, 0x3f, 0x81, 0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x81, 0x02,
+  0xfc, 0x00, 0x7f, 0x85, 0x02, 0xfc, 0x00, 0x7f, 0x81, 0x03, 0xfe, 0x0f,
+  0xf0, 0x7f, 0x81, 0x02, 0xfe, 0x00, 0x3f, 0x85, 0x01, 0xf8, 0x00, 0x82,
+  0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x82, 0xc0, 0x00, 0x1f, 0x85, 0x01, 0xf0,
+  0x01, 0x82, 0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x82, 0x01, 0x80, 0x0f, 0x85,
+  0x01, 0xe0, 0x01, 0x82, 0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x82, 0x01, 0x80,
+  0x07, 0x85, 0x01, 0xc0, 0x03, 0x82, 0x03, 0xfe, 0x0f, 0xf0, 0x7f, 0x82,
+  0x01, 0xc0, 0x03, 0x85, 0x01, 0x80, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0xf0,
+  0x7f, 0x82, 0x01, 0xc0, 0x01, 0x85, 0xc0, 0x00, 0x03, 0x82, 0x03, 0xfe,
+  0x0e, 0x70, 0x7f, 0x82, 0x01, 0xc0, 0x00, 0x84, 0x02, 0xfe, 0x00, 0x03,
+  0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02, 0xc0, 0x00, 0x7f, 0x83,
+  0x02, 0xfc, 0x00, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02,
+  0xc0, 0x00, 0x3f, 0x83, 0x02, 0xf8, 0x00, 0x03, 0x82, 0x03, 0xfe, 0x0e,
+  0x70, 0x7f, 0x82, 0x02, 0xc0, 0x00, 0x1f, 0x83, 0x02, 0xf0, 0x00, 0x03,
+  0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02, 0xc0, 0x00, 0x0f, 0x83,
+  0x02, 0xe0, 0x00, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02,
+  0xc0, 0x00, 0x07, 0x83, 0x02, 0xc0, 0x04, 0x03, 0x82, 0x03, 0xfe, 0x0e,
+  0x70, 0x7f, 0x82, 0x02, 0xc0, 0x20, 0x03, 0x83, 0x02, 0xc0, 0x0c, 0x03,
+  0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02, 0xc0, 0x30, 0x03, 0x83,
+  0x02, 0xc0, 0x1c, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02,
+  0xc0, 0x38, 0x03, 0x83, 0x02, 0xc0, 0x3c, 0x03, 0x82, 0x03, 0xfe, 0x0e,
+  0x70, 0x7f, 0x82, 0x02, 0xc0, 0x3c, 0x03, 0x83, 0x02, 0xc0, 0x7c, 0x03,
+  0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02, 0xc0, 0x3e, 0x03, 0x83,
+  0x02, 0xe0, 0xfc, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x02,
+  0xc0, 0x3f, 0x07, 0x84, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70,
+  0x7f, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xfe,
+  0x0e, 0x70, 0x7f, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82,
+  0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc,
+  0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x01, 0xc0, 0x3f, 0x85,
+  0x01, 0xfc, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82, 0x01, 0xc0,
+  0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xfe, 0x0e, 0x70, 0x7f, 0x82,
+  0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xfc, 0x0e, 0x70,
+  0x3f, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xf8,
+  0x0e, 0x70, 0x1f, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82,
+  0x03, 0xf0, 0x0e, 0x70, 0x0f, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc,
+  0x03, 0x82, 0x03, 0xe0, 0x3e, 0x7c, 0x07, 0x82, 0x01, 0xc0, 0x3f, 0x85,
+  0x01, 0xfc, 0x03, 0x82, 0x03, 0xc0, 0x7c, 0x3e, 0x03, 0x82, 0x01, 0xc0,
+  0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xc0, 0xf0, 0x0f, 0x03, 0x82,
+  0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xc1, 0xe0, 0x07,
+  0x83, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0x81,
+  0xc0, 0x03, 0x81, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82,
+  0x03, 0x83, 0x80, 0x01, 0xc1, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc,
+  0x03, 0x82, 0x03, 0x83, 0x80, 0x01, 0xc1, 0x82, 0x01, 0xc0, 0x3f, 0x85,
+  0x01, 0xfc, 0x03, 0x82, 0x03, 0x83, 0x00, 0x01, 0xc1, 0x82, 0x01, 0xc0,
+  0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0x83, 0x00, 0x01, 0xc1, 0x82,
+  0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0x83, 0x00, 0x01,
+  0xc1, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0x83,
+  0x00, 0x01, 0xc1, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82,
+  0x03, 0x83, 0x80, 0x01, 0xc1, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc,
+  0x03, 0x82, 0x03, 0x81, 0x80, 0x01, 0xc1, 0x82, 0x01, 0xc0, 0x3f, 0x85,
+  0x01, 0xfc, 0x03, 0x82, 0x03, 0x81, 0xc0, 0x03, 0x81, 0x82, 0x01, 0xc0,
+  0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xc0, 0xe0, 0x07, 0x83, 0x82,
+  0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xc0, 0xf0, 0x0f,
+  0x03, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x03, 0xe0,
+  0x7e, 0x7e, 0x07, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82,
+  0x03, 0xe0, 0x1f, 0xf8, 0x07, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc,
+  0x03, 0x82, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0x82, 0x01, 0xc0, 0x3f, 0x85,
+  0x01, 0xfc, 0x03, 0x82, 0x00, 0xf8, 0xc1, 0x00, 0x1f, 0x82, 0x01, 0xc0,
+  0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x00, 0xfc, 0xc1, 0x00, 0x3f, 0x82,
+  0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x82, 0x00, 0xfe, 0xc1, 0x00,
+  0x7f, 0x82, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x83, 0x01, 0x80,
+  0x01, 0x83, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x83, 0x01, 0xe0,
+  0x07, 0x83, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x89, 0x01, 0xc0,
+  0x3f, 0x85, 0x01, 0xfc, 0x03, 0x89, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc,
+  0x03, 0x89, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x03, 0x89, 0x01, 0xc0,
+  0x3f, 0x85, 0x01, 0xfc, 0x03, 0x89, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc,
+  0x03, 0x89, 0x01, 0xc0, 0x3f, 0x85, 0x01, 0xfc, 0x01, 0x89, 0x01, 0x80,
+  0x3f, 0x85, 0x01, 0xfc, 0x01, 0x89, 0x01, 0x80, 0x3f, 0x85, 0x01, 0xfe,
+  0x00, 0x89, 0xc0, 0x00, 0x7f, 0x85, 0x00, 0xfe, 0xcb, 0x00, 0x7f, 0x85,
+  0x00, 0xfe, 0xcb, 0x00, 0x7f, 0x86, 0xcb, 0x87, 0x00, 0x80, 0xc9, 0x00,
+  0x01, 0x87, 0x00, 0x80, 0xc9, 0x00, 0x01, 0x87, 0x00, 0xe0, 0xc9, 0x00,
+  0x03, 0x87, 0x00, 0xf0, 0xc9, 0x00, 0x0f, 0x87, 0x00, 0xfc, 0xc9, 0x00,
+  0x3f, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x8f
 };
\ No newline at end of file
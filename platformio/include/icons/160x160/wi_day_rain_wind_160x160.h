@@ -1,270 +1,117 @@
-// 160 x 160
+// 160 x 160, run-length encoded
 const unsigned char wi_day_rain_wind_160x160[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
-  0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xe0,
-  0x1f, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xfd,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x80,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0x00, 0x1f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfc, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-  0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3f, 0xff,
-  0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff,
-  0xf8, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff,
-  0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x01, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff,
-  0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff,
-  0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0x80, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0xff, 0xff, 0x80, 0x1f, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x1f,
-  0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x1f, 0xf8, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f,
-  0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x1f,
-  0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f,
-  0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xc0, 0x1f,
-  0xf8, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x00, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0x80, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x00, 0x07, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x03, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xfe,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xfc, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x01, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xf0, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x03, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xf8,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xf8, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x07, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff,
-  0xff, 0xff, 0xf8, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xfe,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-  0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0x80, 0xff, 0xff,
-  0xff, 0x80, 0x0f, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff,
-  0xff, 0xff, 0xc0, 0x1f, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x1f, 0xff,
-  0xe7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0x80, 0x1f,
-  0xfe, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xff,
-  0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f,
-  0xff, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x3f,
-  0xf8, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x7f, 0xf0, 0x00, 0xff, 0xc0,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x7f, 0xf8, 0x00, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xf0, 0x00, 0xff,
-  0xc0, 0x03, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x01, 0xff, 0xe0, 0x01, 0xff, 0xc0, 0x07, 0xff, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01,
-  0xff, 0xe0, 0x03, 0xff, 0x80, 0x0f, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xc0, 0x07, 0xff,
-  0x00, 0x0f, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x07, 0xff, 0x80, 0x07, 0xfe, 0x00, 0x1f, 0xf8, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-  0xff, 0x00, 0x0f, 0xfc, 0x00, 0x3f, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xfc,
-  0x00, 0x7f, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0x7f, 0xe0, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x7f, 0xf0, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xe0,
-  0x01, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x80, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x01, 0xff, 0xc0, 0x07, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0x80,
-  0x07, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x7f, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xf0, 0x00,
-  0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xe0, 0x01, 0xff, 0xfc, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x07, 0xff, 0xe0, 0x03, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xc0, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x07, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xc0, 0x1f,
-  0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xe0, 0x3f, 0xfc, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x1f, 0xff, 0xf0, 0x7f, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x7f, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xae, 0x01, 0xf0, 0x3f, 0x91, 0x01, 0xe0, 0x1f, 0x91, 0x01, 0xe0,
+  0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0,
+  0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0,
+  0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0,
+  0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0,
+  0x1f, 0x8d, 0x00, 0x0f, 0x82, 0x01, 0xc0, 0x1f, 0x82, 0x00, 0xc3, 0x88,
+  0x01, 0xfc, 0x07, 0x82, 0x01, 0xe0, 0x1f, 0x82, 0x00, 0x80, 0x88, 0x01,
+  0xfc, 0x03, 0x82, 0x01, 0xe0, 0x1f, 0x82, 0xc0, 0x88, 0x01, 0xf8, 0x01,
+  0x82, 0x01, 0xf0, 0x3f, 0x81, 0x02, 0xfe, 0x00, 0x7f, 0x87, 0x01, 0xf8,
+  0x00, 0x82, 0x00, 0xfd, 0x82, 0x02, 0xfc, 0x00, 0x7f, 0x87, 0x02, 0xf8,
+  0x00, 0x7f, 0x85, 0x02, 0xf8, 0x00, 0x7f, 0x87, 0x02, 0xfc, 0x00, 0x7f,
+  0x85, 0x01, 0xf0, 0x00, 0x88, 0x02, 0xfc, 0x00, 0x7f, 0x85, 0x01, 0xe0,
+  0x00, 0x88, 0x02, 0xfe, 0x00, 0x7f, 0x85, 0x01, 0xc0, 0x01, 0x89, 0xc0,
+  0x00, 0x7f, 0x85, 0x01, 0x80, 0x03, 0x89, 0x01, 0x80, 0x7f, 0x85, 0xc0,
+  0x00, 0x07, 0x89, 0x00, 0xc0, 0x86, 0xc0, 0x00, 0x0f, 0x89, 0x00, 0xf3,
+  0x86, 0xc0, 0x00, 0x1f, 0x91, 0xc0, 0x00, 0x7f, 0x8d, 0xc0, 0x00, 0x03,
+  0x81, 0x00, 0x80, 0x8d, 0x00, 0xf8, 0xc1, 0x02, 0x7f, 0xff, 0x81, 0x8d,
+  0x00, 0xe0, 0xc1, 0x02, 0x1f, 0xff, 0xe3, 0x8d, 0x00, 0x80, 0xc1, 0x00,
+  0x07, 0x8e, 0x00, 0xfe, 0xc2, 0x00, 0x01, 0x8c, 0x02, 0x01, 0xff, 0xfc,
+  0xc3, 0x8b, 0x03, 0xe0, 0x00, 0x07, 0xf8, 0xc3, 0x00, 0x7f, 0x8a, 0xc1,
+  0x01, 0x01, 0xf0, 0xc3, 0x00, 0x1f, 0x89, 0x00, 0xfc, 0xc2, 0x00, 0x20,
+  0xc3, 0x00, 0x1f, 0x89, 0x00, 0xf0, 0xc4, 0x03, 0x3f, 0xe0, 0x00, 0x0f,
+  0x89, 0x00, 0xc0, 0xc3, 0x04, 0x01, 0xff, 0xfc, 0x00, 0x07, 0x89, 0x00,
+  0x80, 0xc3, 0x00, 0x07, 0x81, 0xc0, 0x00, 0x03, 0x89, 0xc4, 0x00, 0x0f,
+  0x81, 0x01, 0xc0, 0x01, 0x88, 0x00, 0xfc, 0xc4, 0x00, 0x3f, 0x81, 0x01,
+  0xe0, 0x01, 0x88, 0x00, 0xf8, 0xc1, 0x00, 0x38, 0xc1, 0x00, 0x3f, 0x81,
+  0x01, 0xf0, 0x00, 0x88, 0x06, 0xf0, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x1f,
+  0x81, 0x01, 0xf8, 0x00, 0x88, 0x06, 0xe0, 0x00, 0x3f, 0xff, 0xf8, 0x00,
+  0x0f, 0x81, 0x02, 0xfc, 0x00, 0x7f, 0x87, 0x01, 0xe0, 0x00, 0x81, 0x02,
+  0xfe, 0x00, 0x07, 0x81, 0x02, 0xfe, 0x00, 0x7f, 0x87, 0x01, 0xc0, 0x01,
+  0x82, 0x01, 0x80, 0x07, 0x81, 0x02, 0xfe, 0x00, 0x3f, 0x87, 0x01, 0x80,
+  0x07, 0x82, 0x01, 0xc0, 0x03, 0x82, 0xc0, 0x00, 0x3f, 0x87, 0x01, 0x80,
+  0x0f, 0x82, 0x01, 0xe0, 0x01, 0x82, 0xc0, 0x00, 0x3f, 0x87, 0xc0, 0x00,
+  0x1f, 0x82, 0x01, 0xf0, 0x01, 0x82, 0x01, 0x80, 0x3f, 0x86, 0x02, 0xfe,
+  0x00, 0x3f, 0x82, 0x01, 0xf8, 0x00, 0x82, 0x01, 0x80, 0x1f, 0x86, 0x02,
+  0xfe, 0x00, 0x7f, 0x82, 0x02, 0xfc, 0x00, 0x7f, 0x81, 0x04, 0x80, 0x1f,
+  0xfe, 0x00, 0x07, 0x83, 0x02, 0xfe, 0x00, 0x7f, 0x82, 0x02, 0xfe, 0x00,
+  0x7f, 0x81, 0x04, 0xc0, 0x1f, 0xfc, 0x00, 0x01, 0x83, 0x01, 0xfc, 0x00,
+  0x83, 0x02, 0xfe, 0x00, 0x7f, 0x81, 0x04, 0xc0, 0x1f, 0xf8, 0x00, 0x01,
+  0x83, 0x01, 0xfc, 0x01, 0x84, 0xc0, 0x00, 0x3f, 0x81, 0x02, 0xc0, 0x1f,
+  0xf0, 0xc1, 0x83, 0x01, 0xf8, 0x01, 0x84, 0xc0, 0x00, 0x3f, 0x81, 0x02,
+  0xc0, 0x1f, 0xf0, 0xc1, 0x83, 0x01, 0xf8, 0x03, 0x84, 0x01, 0x80, 0x3f,
+  0x81, 0x02, 0xc0, 0x1f, 0xf0, 0xc1, 0x83, 0x01, 0xf8, 0x03, 0x84, 0x01,
+  0x80, 0x1f, 0x81, 0x02, 0xc0, 0x1f, 0xf0, 0xc1, 0x83, 0x01, 0xf0, 0x03,
+  0x84, 0x08, 0x80, 0x00, 0x3f, 0xff, 0xc0, 0x1f, 0xf8, 0x00, 0x01, 0x83,
+  0x01, 0x80, 0x03, 0x84, 0x08, 0xc0, 0x00, 0x03, 0xff, 0xc0, 0x1f, 0xfc,
+  0x00, 0x03, 0x82, 0x02, 0xfe, 0x00, 0x07, 0x84, 0x00, 0xc0, 0xc1, 0x80,
+  0x01, 0x80, 0x1f, 0x85, 0x02, 0xf8, 0x00, 0x07, 0x84, 0x00, 0xc0, 0xc1,
+  0x02, 0x3f, 0x80, 0x3f, 0x85, 0x02, 0xe0, 0x00, 0x07, 0x84, 0x00, 0xc0,
+  0xc1, 0x02, 0x1f, 0x80, 0x3f, 0x85, 0x02, 0xc0, 0x00, 0x07, 0x84, 0x00,
+  0xc0, 0xc1, 0x02, 0x07, 0x00, 0x3f, 0x85, 0x02, 0x80, 0x00, 0x07, 0x84,
+  0x00, 0xe0, 0xc1, 0x02, 0x03, 0x00, 0x3f, 0x85, 0xc1, 0x00, 0x07, 0x84,
+  0x00, 0xe0, 0xc3, 0x00, 0x7f, 0x84, 0x00, 0xfe, 0xc1, 0x00, 0x0f, 0x84,
+  0x00, 0xe0, 0xc3, 0x00, 0x7f, 0x84, 0x02, 0xfc, 0x00, 0x03, 0x87, 0x00,
+  0x80, 0xc1, 0x85, 0x02, 0xf8, 0x00, 0x1f, 0x87, 0x00, 0xf0, 0xc1, 0x85,
+  0x02, 0xf0, 0x00, 0x7f, 0x87, 0x02, 0xfc, 0x00, 0x01, 0x85, 0x01, 0xf0,
+  0x00, 0x88, 0x02, 0xfe, 0x00, 0x01, 0x85, 0x01, 0xe0, 0x01, 0x89, 0xc0,
+  0x00, 0x03, 0x85, 0x01, 0xe0, 0x03, 0x89, 0x01, 0x80, 0x07, 0x85, 0x01,
+  0xc0, 0x07, 0x89, 0x01, 0xc0, 0x07, 0x85, 0x01, 0xc0, 0x0f, 0x89, 0x01,
+  0xe0, 0x07, 0x85, 0x01, 0x80, 0x1f, 0x89, 0x01, 0xf0, 0x03, 0x85, 0x01,
+  0x80, 0x1f, 0x89, 0x01, 0xf0, 0x03, 0x85, 0x01, 0x80, 0x3f, 0x89, 0x01,
+  0xf8, 0x03, 0x85, 0x01, 0x80, 0x3f, 0x89, 0x01, 0xf8, 0x03, 0x85, 0xc0,
+  0x00, 0x3f, 0x89, 0x01, 0xf8, 0x01, 0x85, 0xc0, 0x00, 0x7f, 0x89, 0x01,
+  0xfc, 0x01, 0x85, 0xc0, 0x00, 0x7f, 0x89, 0x01, 0xfc, 0x01, 0x85, 0xc0,
+  0x00, 0x7f, 0x89, 0x01, 0xfc, 0x01, 0x85, 0xc0, 0x00, 0x7f, 0x89, 0x01,
+  0xfc, 0x01, 0x85, 0xc0, 0x00, 0x7f, 0x89, 0x01, 0xfc, 0x01, 0x85, 0xc0,
+  0x00, 0x7f, 0x89, 0x03, 0xfc, 0x01, 0xfe, 0x3f, 0x83, 0xc0, 0x00, 0x7f,
+  0x89, 0x03, 0xfc, 0x01, 0xfc, 0x0f, 0x83, 0xc0, 0x00, 0x7f, 0x89, 0x03,
+  0xfc, 0x01, 0xf8, 0x07, 0x83, 0xc0, 0x00, 0x3f, 0x89, 0x03, 0xf8, 0x01,
+  0xf0, 0x03, 0x83, 0xc0, 0x00, 0x3f, 0x89, 0x03, 0xf8, 0x03, 0xf0, 0x01,
+  0x83, 0x01, 0x80, 0x3f, 0x89, 0x03, 0xf8, 0x03, 0xf0, 0x00, 0x83, 0x01,
+  0x80, 0x1f, 0x89, 0x03, 0xf0, 0x03, 0xf8, 0x00, 0x83, 0x01, 0x80, 0x1f,
+  0x89, 0x04, 0xf0, 0x03, 0xf8, 0x00, 0x7f, 0x82, 0x01, 0xc0, 0x0f, 0x89,
+  0x04, 0xe0, 0x07, 0xfc, 0x00, 0x7f, 0x82, 0x01, 0xc0, 0x0f, 0x82, 0x00,
+  0xf8, 0x81, 0x00, 0xe3, 0x82, 0x04, 0xc0, 0x07, 0xfe, 0x00, 0x7f, 0x82,
+  0x01, 0xc0, 0x07, 0x82, 0x03, 0xe0, 0x3f, 0xff, 0xc0, 0x82, 0x03, 0xc0,
+  0x0f, 0xff, 0x00, 0x83, 0x01, 0xe0, 0x03, 0x82, 0x03, 0xc0, 0x1f, 0xff,
+  0x80, 0x82, 0x03, 0x80, 0x0f, 0xff, 0x81, 0x83, 0x01, 0xe0, 0x01, 0x82,
+  0x04, 0xc0, 0x1f, 0xff, 0x00, 0x7f, 0x81, 0xc0, 0x02, 0x1f, 0xff, 0xe7,
+  0x83, 0x01, 0xf0, 0x00, 0x82, 0x08, 0x80, 0x1f, 0xfe, 0x00, 0x7f, 0xff,
+  0xfc, 0x00, 0x1f, 0x85, 0x02, 0xf8, 0x00, 0x3f, 0x81, 0xc0, 0x07, 0x1f,
+  0xfc, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x3f, 0x85, 0x0d, 0xf8, 0x00, 0x0f,
+  0xff, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x7f, 0x85,
+  0x00, 0xfc, 0xc1, 0x80, 0x06, 0xfc, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xfc,
+  0xc1, 0x86, 0x00, 0xfe, 0xc1, 0x09, 0x3f, 0xfc, 0x00, 0x7f, 0xf0, 0x00,
+  0xff, 0xc0, 0x00, 0x01, 0x87, 0xc1, 0x09, 0x7f, 0xf8, 0x00, 0xff, 0xe0,
+  0x01, 0xff, 0x80, 0x00, 0x03, 0x87, 0x08, 0x80, 0x00, 0xff, 0xf0, 0x00,
+  0xff, 0xc0, 0x03, 0xff, 0xc1, 0x00, 0x07, 0x87, 0x08, 0xe0, 0x01, 0xff,
+  0xe0, 0x01, 0xff, 0xc0, 0x07, 0xff, 0xc1, 0x00, 0x0f, 0x87, 0x08, 0xf0,
+  0x01, 0xff, 0xe0, 0x03, 0xff, 0x80, 0x0f, 0xfe, 0xc1, 0x00, 0x1f, 0x87,
+  0x08, 0xfc, 0x03, 0xff, 0xc0, 0x07, 0xff, 0x00, 0x0f, 0xfc, 0xc1, 0x00,
+  0x7f, 0x88, 0x09, 0x07, 0xff, 0x80, 0x07, 0xfe, 0x00, 0x1f, 0xf8, 0x00,
+  0x01, 0x89, 0x09, 0xcf, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x3f, 0xf0, 0x00,
+  0x0f, 0x8b, 0xc0, 0x05, 0x1f, 0xfc, 0x00, 0x7f, 0xf0, 0x01, 0x8b, 0x07,
+  0xfe, 0x00, 0x3f, 0xf8, 0x00, 0x7f, 0xe0, 0x03, 0x8b, 0x07, 0xfe, 0x00,
+  0x7f, 0xf0, 0x00, 0xff, 0xc0, 0x03, 0x8b, 0x07, 0xfc, 0x00, 0x7f, 0xe0,
+  0x01, 0xff, 0x80, 0x07, 0x8b, 0x07, 0xfc, 0x00, 0xff, 0xe0, 0x03, 0xff,
+  0x80, 0x0f, 0x8b, 0x07, 0xfe, 0x01, 0xff, 0xc0, 0x07, 0xff, 0x00, 0x1f,
+  0x8b, 0x07, 0xfe, 0x03, 0xff, 0x80, 0x07, 0xfe, 0x00, 0x1f, 0x8c, 0x06,
+  0x87, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x3f, 0x8d, 0x05, 0xfe, 0x00, 0x1f,
+  0xfc, 0x00, 0x7f, 0x8d, 0x04, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0x8e, 0x04,
+  0xfc, 0x00, 0x7f, 0xf8, 0x01, 0x8e, 0x04, 0xf8, 0x00, 0x7f, 0xf8, 0x01,
+  0x8b, 0x07, 0xfe, 0x1f, 0xff, 0xf0, 0x00, 0xff, 0xf8, 0x03, 0x8b, 0x07,
+  0xfc, 0x0f, 0xff, 0xe0, 0x01, 0xff, 0xfc, 0x07, 0x8b, 0x07, 0xf8, 0x07,
+  0xff, 0xe0, 0x03, 0xff, 0xfe, 0x0f, 0x8b, 0x04, 0xf8, 0x07, 0xff, 0xc0,
+  0x07, 0x8e, 0x04, 0xf8, 0x03, 0xff, 0xc0, 0x07, 0x8e, 0x04, 0xf8, 0x07,
+  0xff, 0xc0, 0x0f, 0x8e, 0x06, 0xf8, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0x1f,
+  0x8c, 0x06, 0xfc, 0x0f, 0xff, 0xe0, 0x3f, 0xfc, 0x0f, 0x8c, 0x06, 0xfe,
+  0x1f, 0xff, 0xf0, 0x7f, 0xf8, 0x07, 0x91, 0x01, 0xf8, 0x03, 0x91, 0x01,
+  0xf8, 0x03, 0x91, 0x01, 0xf8, 0x03, 0x91, 0x01, 0xf8, 0x03, 0x8e, 0x00,
+  0xe0, 0x81, 0x01, 0xfc, 0x07, 0x8e, 0x04, 0xc0, 0x7f, 0xff, 0xfe, 0x0f,
+  0x8e, 0x01, 0xc0, 0x3f, 0x91, 0x01, 0x80, 0x3f, 0x91, 0x01, 0x80, 0x3f,
+  0x91, 0x01, 0x80, 0x3f, 0x91, 0x01, 0xc0, 0x3f, 0x91, 0x01, 0xc0, 0x7f,
+  0x91, 0x00, 0xf0, 0xbf, 0xbf, 0xbf, 0x95
 };
\ No newline at end of file
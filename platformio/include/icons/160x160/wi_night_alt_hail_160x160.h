@@ -1,270 +1,97 @@
-// 160 x 160
+// 160 x 160, run-length encoded
 const unsigned char wi_night_alt_hail_160x160[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x00,
-  0x03, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7e, 0x00, 0x0f, 0xff, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0x06, 0x00, 0x1f, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-  0x3f, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x80, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00,
-  0x3f, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xe0, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x80,
-  0x07, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xf8, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x03, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xfe, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x01, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xc0,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x03, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xfc,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x78, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x30, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01,
-  0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0x0f, 0xff, 0x83, 0xff, 0xff, 0xf0,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xf0,
-  0x1f, 0xfc, 0x07, 0xff, 0x01, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xfc, 0x03, 0xff,
-  0x00, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf8, 0x03, 0xfe, 0x00, 0xff, 0xff, 0xe0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xe0,
-  0x0f, 0xf8, 0x03, 0xfe, 0x00, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf8, 0x03, 0xfe,
-  0x00, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x7f, 0xff, 0xff, 0xc0, 0x0f, 0xf8, 0x03, 0xfc, 0x00, 0xff, 0xff, 0xc0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xc0,
-  0x0f, 0xf0, 0x03, 0xfc, 0x01, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x07, 0xfc,
-  0x01, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x3f, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x07, 0xfc, 0x01, 0xff, 0xff, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x80,
-  0x1f, 0xe0, 0x07, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0x80, 0x3f, 0xe0, 0x07, 0xf8,
-  0x03, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x07, 0xff, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xf8, 0x03, 0xff, 0xf8, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00,
-  0x3f, 0xe0, 0x0f, 0xf0, 0x03, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xc0, 0x0f, 0xf0,
-  0x07, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x8f, 0x02, 0xfe,
+  0x00, 0x07, 0x90, 0x00, 0xf0, 0xc1, 0x90, 0x00, 0x80, 0xc1, 0x00, 0x3f,
+  0x8f, 0xc2, 0x00, 0x3f, 0x8e, 0x00, 0xfc, 0xc2, 0x00, 0x3f, 0x8e, 0x00,
+  0xf8, 0xc2, 0x00, 0x7f, 0x8e, 0x00, 0xf0, 0xc2, 0x00, 0x7f, 0x8e, 0x00,
+  0xe0, 0xc2, 0x00, 0x7f, 0x8e, 0x00, 0xc0, 0xc2, 0x00, 0x7f, 0x8e, 0x04,
+  0x80, 0x00, 0x7f, 0x00, 0x7f, 0x8c, 0x06, 0xbf, 0xff, 0x00, 0x03, 0xff,
+  0x00, 0x7f, 0x8b, 0x07, 0x80, 0x00, 0x7e, 0x00, 0x0f, 0xff, 0x00, 0x7f,
+  0x8a, 0x00, 0xfc, 0xc1, 0x05, 0x06, 0x00, 0x1f, 0xff, 0x00, 0x7f, 0x8a,
+  0x00, 0xf0, 0xc3, 0x03, 0x3f, 0xff, 0x00, 0x7f, 0x8a, 0x00, 0xc0, 0xc3,
+  0x03, 0x7f, 0xff, 0x00, 0x7f, 0x8a, 0xc4, 0x81, 0xc0, 0x00, 0x7f, 0x89,
+  0x00, 0xfe, 0xc3, 0x00, 0x01, 0x81, 0xc0, 0x00, 0x3f, 0x89, 0x00, 0xf8,
+  0xc3, 0x00, 0x03, 0x81, 0x01, 0x80, 0x3f, 0x89, 0x00, 0xf0, 0xc3, 0x00,
+  0x03, 0x81, 0x01, 0x80, 0x1f, 0x89, 0x00, 0xe0, 0xc4, 0x81, 0x01, 0x80,
+  0x1f, 0x89, 0x03, 0xc0, 0x00, 0x1f, 0xff, 0xc1, 0x03, 0x7f, 0xff, 0xc0,
+  0x0f, 0x89, 0x01, 0x80, 0x00, 0x81, 0x05, 0xe0, 0x00, 0x3f, 0xff, 0xc0,
+  0x0f, 0x89, 0xc0, 0x00, 0x03, 0x81, 0x05, 0xf8, 0x00, 0x3f, 0xff, 0xc0,
+  0x07, 0x89, 0xc0, 0x00, 0x07, 0x81, 0x05, 0xfc, 0x00, 0x1f, 0xff, 0xe0,
+  0x03, 0x88, 0x02, 0xfe, 0x00, 0x1f, 0x82, 0xc0, 0x03, 0x0f, 0xff, 0xe0,
+  0x01, 0x88, 0x02, 0xfc, 0x00, 0x3f, 0x82, 0x04, 0x80, 0x07, 0xff, 0xf0,
+  0x00, 0x88, 0x02, 0xfc, 0x00, 0x7f, 0x82, 0x05, 0xc0, 0x07, 0xff, 0xf8,
+  0x00, 0x3f, 0x87, 0x01, 0xf8, 0x00, 0x83, 0x05, 0xe0, 0x03, 0xff, 0xf8,
+  0x00, 0x0f, 0x87, 0x01, 0xf8, 0x01, 0x83, 0x05, 0xf0, 0x03, 0xff, 0xfc,
+  0x00, 0x03, 0x87, 0x01, 0xf0, 0x01, 0x83, 0x03, 0xf0, 0x01, 0xff, 0xfe,
+  0xc1, 0x00, 0x7f, 0x86, 0x01, 0xf0, 0x03, 0x83, 0x01, 0xf8, 0x01, 0x81,
+  0xc1, 0x00, 0x3f, 0x86, 0x01, 0xe0, 0x07, 0x83, 0x01, 0xfc, 0x01, 0x81,
+  0x02, 0x80, 0x00, 0x3f, 0x86, 0x01, 0xe0, 0x07, 0x83, 0x01, 0xfc, 0x00,
+  0x81, 0x02, 0xc0, 0x00, 0x3f, 0x86, 0x01, 0xe0, 0x0f, 0x83, 0x01, 0xfc,
+  0x00, 0x81, 0x02, 0xf0, 0x00, 0x3f, 0x86, 0x01, 0xe0, 0x0f, 0x83, 0x01,
+  0xfe, 0x00, 0x81, 0x02, 0xf8, 0x00, 0x7f, 0x86, 0x01, 0xc0, 0x0f, 0x83,
+  0x00, 0xfe, 0xc1, 0x80, 0x02, 0xfe, 0x00, 0x7f, 0x85, 0x02, 0xfe, 0x00,
+  0x0f, 0x83, 0x00, 0xfe, 0xc1, 0x03, 0x1f, 0xfe, 0x00, 0x7f, 0x85, 0x02,
+  0xf0, 0x00, 0x1f, 0x84, 0xc1, 0x02, 0x03, 0xfc, 0x00, 0x86, 0x02, 0xe0,
+  0x00, 0x1f, 0x84, 0xc2, 0x01, 0xfc, 0x00, 0x86, 0x02, 0x80, 0x00, 0x1f,
+  0x84, 0xc2, 0x01, 0x78, 0x01, 0x86, 0xc1, 0x00, 0x1f, 0x84, 0xc2, 0x01,
+  0x30, 0x01, 0x85, 0x00, 0xfe, 0xc1, 0x00, 0x1f, 0x84, 0xc3, 0x00, 0x03,
+  0x85, 0x00, 0xfc, 0xc1, 0x00, 0x1f, 0x84, 0xc3, 0x00, 0x03, 0x85, 0x00,
+  0xf8, 0xc1, 0x00, 0x3f, 0x84, 0x00, 0x80, 0xc2, 0x00, 0x07, 0x85, 0x02,
+  0xf0, 0x00, 0x0f, 0x86, 0x00, 0xfe, 0xc1, 0x00, 0x0f, 0x85, 0x02, 0xe0,
+  0x00, 0x7f, 0x87, 0x02, 0x80, 0x00, 0x0f, 0x85, 0x01, 0xc0, 0x01, 0x88,
+  0x02, 0xe0, 0x00, 0x1f, 0x85, 0x01, 0xc0, 0x03, 0x88, 0x02, 0xf8, 0x00,
+  0x3f, 0x85, 0x01, 0x80, 0x07, 0x88, 0x02, 0xfc, 0x00, 0x7f, 0x85, 0x01,
+  0x80, 0x0f, 0x88, 0x02, 0xfe, 0x00, 0x3f, 0x85, 0xc0, 0x00, 0x1f, 0x89,
+  0xc0, 0x00, 0x3f, 0x85, 0xc0, 0x00, 0x3f, 0x89, 0xc0, 0x00, 0x1f, 0x84,
+  0x02, 0xfe, 0x00, 0x7f, 0x89, 0x01, 0x80, 0x1f, 0x84, 0x02, 0xfe, 0x00,
+  0x7f, 0x89, 0x01, 0xc0, 0x1f, 0x84, 0x01, 0xfe, 0x00, 0x8a, 0x01, 0xc0,
+  0x0f, 0x84, 0x01, 0xfc, 0x00, 0x8a, 0x01, 0xe0, 0x0f, 0x84, 0x01, 0xfc,
+  0x00, 0x8a, 0x01, 0xe0, 0x0f, 0x84, 0x01, 0xfc, 0x01, 0x8a, 0x01, 0xe0,
+  0x0f, 0x84, 0x01, 0xfc, 0x01, 0x8a, 0x01, 0xe0, 0x0f, 0x84, 0x01, 0xfc,
+  0x01, 0x8a, 0x01, 0xe0, 0x0f, 0x84, 0x01, 0xfc, 0x01, 0x8a, 0x01, 0xf0,
+  0x07, 0x84, 0x01, 0xfc, 0x01, 0x8a, 0x01, 0xf0, 0x07, 0x84, 0x01, 0xfc,
+  0x01, 0x82, 0x05, 0xf8, 0x3f, 0xff, 0x0f, 0xff, 0x83, 0x81, 0x01, 0xf0,
+  0x07, 0x84, 0x01, 0xfc, 0x01, 0x82, 0x05, 0xf0, 0x1f, 0xfc, 0x07, 0xff,
+  0x01, 0x81, 0x01, 0xe0, 0x0f, 0x84, 0x01, 0xfc, 0x01, 0x82, 0x05, 0xf0,
+  0x0f, 0xfc, 0x03, 0xff, 0x00, 0x81, 0x01, 0xe0, 0x0f, 0x84, 0x01, 0xfc,
+  0x00, 0x82, 0x05, 0xe0, 0x0f, 0xf8, 0x03, 0xfe, 0x00, 0x81, 0x01, 0xe0,
+  0x0f, 0x84, 0x01, 0xfc, 0x00, 0x82, 0x05, 0xe0, 0x0f, 0xf8, 0x03, 0xfe,
+  0x00, 0x81, 0x01, 0xe0, 0x0f, 0x84, 0x01, 0xfe, 0x00, 0x82, 0x05, 0xe0,
+  0x0f, 0xf8, 0x03, 0xfe, 0x00, 0x81, 0x01, 0xc0, 0x0f, 0x84, 0x02, 0xfe,
+  0x00, 0x7f, 0x81, 0x05, 0xc0, 0x0f, 0xf8, 0x03, 0xfc, 0x00, 0x81, 0x01,
+  0xc0, 0x0f, 0x84, 0x02, 0xfe, 0x00, 0x7f, 0x81, 0x05, 0xc0, 0x0f, 0xf0,
+  0x03, 0xfc, 0x01, 0x81, 0x01, 0x80, 0x1f, 0x85, 0xc0, 0x00, 0x3f, 0x81,
+  0x05, 0xc0, 0x1f, 0xf0, 0x07, 0xfc, 0x01, 0x81, 0x01, 0x80, 0x1f, 0x85,
+  0xc0, 0x00, 0x3f, 0x81, 0x05, 0xc0, 0x1f, 0xf0, 0x07, 0xfc, 0x01, 0x81,
+  0xc0, 0x00, 0x1f, 0x85, 0xc0, 0x00, 0x1f, 0x81, 0x09, 0x80, 0x1f, 0xe0,
+  0x07, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0x3f, 0x85, 0x01, 0x80, 0x0f, 0x81,
+  0x09, 0x80, 0x3f, 0xe0, 0x07, 0xf8, 0x03, 0xff, 0xfc, 0x00, 0x3f, 0x85,
+  0x01, 0x80, 0x07, 0x81, 0x09, 0x80, 0x3f, 0xe0, 0x0f, 0xf8, 0x03, 0xff,
+  0xf8, 0x00, 0x7f, 0x85, 0x01, 0xc0, 0x03, 0x81, 0xc0, 0x07, 0x3f, 0xe0,
+  0x0f, 0xf0, 0x03, 0xff, 0xf0, 0x00, 0x86, 0x01, 0xe0, 0x00, 0x81, 0xc0,
+  0x07, 0x3f, 0xc0, 0x0f, 0xf0, 0x07, 0xff, 0xe0, 0x00, 0x86, 0x0c, 0xf0,
   0x00, 0x3f, 0xff, 0x00, 0x7f, 0xc0, 0x1f, 0xf0, 0x07, 0xff, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0x00,
-  0x7f, 0xc0, 0x1f, 0xf0, 0x07, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xfe, 0x00, 0x7f, 0xc0, 0x1f, 0xe0,
-  0x07, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0xfe, 0x00, 0x7f, 0x80, 0x1f, 0xe0, 0x0f, 0xc0, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0x00,
-  0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xfe, 0x00, 0xff, 0x80, 0x3f, 0xe0,
-  0x0f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0xfc, 0x00, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xc0, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xfe, 0x01,
-  0xff, 0x00, 0x3f, 0xe0, 0x1f, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x7f, 0xe0,
-  0x1f, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0xff, 0x01, 0xff, 0x00, 0x7f, 0xf0, 0x3f, 0xc0, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x83,
-  0xfe, 0x00, 0x7f, 0xfc, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-  0xfc, 0x01, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xfc, 0x01, 0xff, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x1f, 0xf8, 0x01, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f,
-  0xf8, 0x03, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf8, 0x03, 0xfe, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x1f, 0xf0, 0x03, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f,
-  0xf0, 0x03, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xf8, 0x07, 0xff, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x0c, 0xf0, 0x00, 0x03, 0xff, 0x00, 0x7f, 0xc0, 0x1f, 0xf0, 0x07,
+  0xf0, 0x00, 0x03, 0x86, 0x00, 0xf8, 0xc1, 0x09, 0xfe, 0x00, 0x7f, 0xc0,
+  0x1f, 0xe0, 0x07, 0xc0, 0x00, 0x07, 0x86, 0x00, 0xfc, 0xc1, 0x09, 0xfe,
+  0x00, 0x7f, 0x80, 0x1f, 0xe0, 0x0f, 0xc0, 0x00, 0x0f, 0x86, 0x00, 0xfe,
+  0xc1, 0x09, 0xfe, 0x00, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xc0, 0x00, 0x1f,
+  0x87, 0x0b, 0x80, 0x00, 0xfe, 0x00, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xc0,
+  0x00, 0x3f, 0x87, 0x0a, 0xc0, 0x00, 0xfc, 0x00, 0xff, 0x80, 0x3f, 0xe0,
+  0x0f, 0xc0, 0x00, 0x88, 0x0a, 0xf0, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x3f,
+  0xe0, 0x1f, 0xc0, 0x01, 0x88, 0x0a, 0xfc, 0x00, 0xfe, 0x01, 0xff, 0x00,
+  0x7f, 0xe0, 0x1f, 0xc0, 0x07, 0x89, 0x09, 0x80, 0xff, 0x01, 0xff, 0x00,
+  0x7f, 0xf0, 0x3f, 0xc0, 0x3f, 0x89, 0x08, 0xfc, 0xff, 0x83, 0xfe, 0x00,
+  0x7f, 0xfc, 0xff, 0xef, 0x8d, 0x02, 0xfe, 0x00, 0x7f, 0x90, 0x01, 0xfe,
+  0x00, 0x91, 0x01, 0xfe, 0x00, 0x91, 0x01, 0xfc, 0x00, 0x91, 0x01, 0xfc,
+  0x01, 0x8f, 0x05, 0xf8, 0x3f, 0xfc, 0x01, 0xff, 0x83, 0x8d, 0x05, 0xf0,
+  0x1f, 0xfc, 0x01, 0xff, 0x01, 0x8d, 0x05, 0xe0, 0x1f, 0xf8, 0x01, 0xfe,
+  0x01, 0x8d, 0x05, 0xe0, 0x0f, 0xf8, 0x03, 0xfe, 0x00, 0x8d, 0x05, 0xe0,
+  0x0f, 0xf8, 0x03, 0xfe, 0x00, 0x8d, 0x05, 0xe0, 0x1f, 0xf0, 0x03, 0xfe,
+  0x01, 0x8d, 0x05, 0xf0, 0x1f, 0xf0, 0x03, 0xfe, 0x01, 0x8d, 0x05, 0xf8,
+  0x3f, 0xf8, 0x07, 0xff, 0x03, 0x8f, 0x01, 0xf8, 0x07, 0x91, 0x01, 0xfc,
+  0x0f, 0x92, 0x00, 0x3f, 0xbf, 0xb5, 0x00, 0xe1, 0x92, 0x00, 0xc0, 0x92,
+  0x01, 0x80, 0x7f, 0x91, 0x01, 0x80, 0x7f, 0x91, 0xc0, 0x00, 0x7f, 0x91,
+  0x01, 0x80, 0x7f, 0x91, 0x01, 0x80, 0x7f, 0x91, 0x00, 0xc0, 0x92, 0x00,
+  0xe3, 0xbf, 0xbf, 0xbf, 0xbf, 0x8e
 };
\ No newline at end of file
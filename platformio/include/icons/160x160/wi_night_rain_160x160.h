@@ -1,270 +1,100 @@
-// 160 x 160
+// 160 x 160, run-length encoded
 const unsigned char wi_night_rain_160x160[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf8,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0f, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf0,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x3f, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xf8, 0x00,
-  0x1f, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xfc,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0,
-  0x07, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xfe,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x01, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x03, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0xfe,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x1c, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x0c,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0x07, 0xff, 0xc1, 0xff, 0xff, 0xf0,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xf8,
-  0x0f, 0xfe, 0x03, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xfc, 0x01, 0xff,
-  0x00, 0x7f, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0xff, 0xff, 0xff, 0xf0, 0x07, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0xff, 0xf0,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xf0,
-  0x07, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xf0, 0x07, 0xfc, 0x01, 0xff,
-  0x00, 0x7f, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x7f, 0xff, 0xff, 0xe0, 0x07, 0xf8, 0x01, 0xfe, 0x00, 0x7f, 0xff, 0xe0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xe0,
-  0x0f, 0xf8, 0x03, 0xfe, 0x00, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x0f, 0xf8, 0x03, 0xfe,
-  0x00, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x1f, 0xff, 0xff, 0xe0, 0x0f, 0xf8, 0x03, 0xfe, 0x00, 0xff, 0xff, 0x80,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xc0,
-  0x0f, 0xf0, 0x03, 0xfc, 0x01, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x07, 0xfc,
-  0x01, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x03, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x07, 0xfc, 0x01, 0xff, 0xfc, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xc0,
-  0x1f, 0xe0, 0x07, 0xfc, 0x01, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0x80, 0x1f, 0xe0, 0x0f, 0xf8,
-  0x03, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x1f, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xf8, 0x03, 0xff, 0x80, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0x80,
-  0x3f, 0xe0, 0x0f, 0xf8, 0x03, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0x00, 0x3f, 0xc0, 0x0f, 0xf0,
-  0x03, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x7f, 0x00, 0x3f, 0xc0, 0x1f, 0xf0, 0x07, 0xe0, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0x00,
-  0x7f, 0xc0, 0x1f, 0xf0, 0x07, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0x00, 0x7f, 0xc0, 0x1f, 0xf0,
-  0x07, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x7e, 0x00, 0x7f, 0x80, 0x1f, 0xe0, 0x07, 0xe0, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7e, 0x00,
-  0x7f, 0x80, 0x3f, 0xe0, 0x0f, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7e, 0x00, 0xff, 0x80, 0x3f, 0xe0,
-  0x0f, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x7e, 0x00, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xe0, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7c, 0x00,
-  0xff, 0x00, 0x3f, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0x00, 0x7f, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01,
-  0xff, 0x00, 0x7f, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xfe, 0x00, 0x7f, 0x80,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x03, 0xfe, 0x00, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03,
-  0xfe, 0x00, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xfc, 0x00, 0xff, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x03, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07,
-  0xfc, 0x01, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xfc, 0x01, 0xff, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x07, 0xf8, 0x01, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f,
-  0xf8, 0x03, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xf8, 0x03, 0xff, 0xc1,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb3, 0x02,
+  0xfe, 0x00, 0x0f, 0x90, 0x02, 0xe0, 0x00, 0x01, 0x90, 0x00, 0x80, 0xc1,
+  0x00, 0x3f, 0x8e, 0x00, 0xfe, 0xc2, 0x00, 0x1f, 0x8e, 0x00, 0xfc, 0xc2,
+  0x00, 0x07, 0x8c, 0x02, 0xdf, 0xff, 0xf8, 0xc2, 0x00, 0x03, 0x8b, 0x03,
+  0xc0, 0x00, 0x3f, 0xe0, 0xc3, 0x8a, 0x00, 0xfe, 0xc1, 0x01, 0x07, 0xc0,
+  0xc3, 0x00, 0x7f, 0x89, 0x00, 0xf8, 0xc2, 0x00, 0x80, 0xc3, 0x00, 0x3f,
+  0x89, 0x00, 0xe0, 0xc4, 0x03, 0x7f, 0x80, 0x00, 0x1f, 0x89, 0x00, 0x80,
+  0xc3, 0x04, 0x03, 0xff, 0xf8, 0x00, 0x0f, 0x89, 0xc4, 0x04, 0x0f, 0xff,
+  0xfe, 0x00, 0x0f, 0x88, 0x00, 0xfc, 0xc4, 0x00, 0x3f, 0x81, 0xc0, 0x00,
+  0x07, 0x88, 0x00, 0xf8, 0xc4, 0x00, 0x7f, 0x81, 0x01, 0xc0, 0x03, 0x88,
+  0x00, 0xf0, 0xc4, 0x82, 0x01, 0xe0, 0x03, 0x88, 0x03, 0xe0, 0x00, 0x07,
+  0xff, 0xc1, 0x00, 0x7f, 0x81, 0x01, 0xf0, 0x01, 0x88, 0x06, 0xc0, 0x00,
+  0x3f, 0xff, 0xe0, 0x00, 0x3f, 0x81, 0x01, 0xf0, 0x01, 0x88, 0x01, 0x80,
+  0x01, 0x81, 0x02, 0xf8, 0x00, 0x1f, 0x81, 0x01, 0xf8, 0x00, 0x88, 0x01,
+  0x80, 0x03, 0x81, 0x02, 0xfe, 0x00, 0x0f, 0x81, 0x01, 0xfc, 0x00, 0x88,
+  0xc0, 0x00, 0x0f, 0x82, 0xc0, 0x00, 0x07, 0x81, 0x01, 0xfc, 0x00, 0x87,
+  0x02, 0xfe, 0x00, 0x1f, 0x82, 0x01, 0xc0, 0x07, 0x81, 0x02, 0xfe, 0x00,
+  0x7f, 0x86, 0x02, 0xfe, 0x00, 0x3f, 0x82, 0x01, 0xe0, 0x03, 0x81, 0x02,
+  0xfe, 0x00, 0x7f, 0x86, 0x02, 0xfc, 0x00, 0x7f, 0x82, 0x01, 0xf0, 0x03,
+  0x81, 0x02, 0xfe, 0x00, 0x7f, 0x86, 0x01, 0xfc, 0x00, 0x83, 0x01, 0xf0,
+  0x01, 0x82, 0xc0, 0x00, 0x7f, 0x86, 0x01, 0xf8, 0x00, 0x83, 0x01, 0xf8,
+  0x01, 0x82, 0xc0, 0x00, 0x7f, 0x86, 0x01, 0xf8, 0x01, 0x83, 0x01, 0xfc,
+  0x00, 0x82, 0xc0, 0x00, 0x7f, 0x86, 0x01, 0xf0, 0x03, 0x83, 0x01, 0xfc,
+  0x00, 0x82, 0xc0, 0x00, 0x7f, 0x86, 0x01, 0xf0, 0x03, 0x83, 0x01, 0xfe,
+  0x00, 0x82, 0xc0, 0x00, 0x7f, 0x86, 0x01, 0xf0, 0x07, 0x83, 0x02, 0xfe,
+  0x00, 0x7f, 0x81, 0xc0, 0x00, 0x7f, 0x86, 0x01, 0xf0, 0x07, 0x84, 0xc0,
+  0x00, 0x7f, 0x81, 0xc0, 0x00, 0x7f, 0x86, 0x01, 0xe0, 0x07, 0x84, 0xc1,
+  0x81, 0xc0, 0x00, 0x7f, 0x86, 0xc0, 0x00, 0x0f, 0x84, 0xc1, 0x03, 0x0f,
+  0xff, 0x00, 0x7f, 0x85, 0x02, 0xfc, 0x00, 0x0f, 0x84, 0x05, 0x80, 0x00,
+  0x03, 0xff, 0x00, 0x7f, 0x85, 0x02, 0xf0, 0x00, 0x0f, 0x84, 0x00, 0x80,
+  0xc1, 0x02, 0xfe, 0x00, 0x7f, 0x85, 0x02, 0xc0, 0x00, 0x0f, 0x84, 0x00,
+  0x80, 0xc1, 0x02, 0x3e, 0x00, 0x7f, 0x85, 0x02, 0x80, 0x00, 0x0f, 0x84,
+  0x00, 0x80, 0xc1, 0x01, 0x1c, 0x00, 0x86, 0xc1, 0x00, 0x0f, 0x84, 0x00,
+  0x80, 0xc1, 0x01, 0x0c, 0x00, 0x85, 0x00, 0xfe, 0xc1, 0x00, 0x0f, 0x84,
+  0x00, 0x80, 0xc3, 0x85, 0x00, 0xfc, 0xc1, 0x00, 0x1f, 0x84, 0x00, 0xc0,
+  0xc2, 0x00, 0x01, 0x85, 0x02, 0xf8, 0x00, 0x07, 0x86, 0x00, 0xfe, 0xc1,
+  0x00, 0x01, 0x85, 0x02, 0xf0, 0x00, 0x3f, 0x87, 0x02, 0xc0, 0x00, 0x01,
+  0x85, 0x01, 0xe0, 0x00, 0x88, 0x02, 0xf0, 0x00, 0x03, 0x85, 0x01, 0xe0,
+  0x01, 0x88, 0x02, 0xf8, 0x00, 0x07, 0x85, 0x01, 0xc0, 0x03, 0x88, 0x02,
+  0xfe, 0x00, 0x07, 0x85, 0x01, 0xc0, 0x07, 0x89, 0xc0, 0x00, 0x0f, 0x85,
+  0x01, 0x80, 0x0f, 0x89, 0x01, 0x80, 0x1f, 0x85, 0x01, 0x80, 0x1f, 0x89,
+  0x01, 0x80, 0x0f, 0x85, 0xc0, 0x00, 0x3f, 0x89, 0x01, 0xc0, 0x0f, 0x85,
+  0xc0, 0x00, 0x3f, 0x89, 0x01, 0xe0, 0x0f, 0x85, 0xc0, 0x00, 0x7f, 0x89,
+  0x01, 0xe0, 0x07, 0x84, 0x02, 0xfe, 0x00, 0x7f, 0x89, 0x01, 0xe0, 0x07,
+  0x84, 0x02, 0xfe, 0x00, 0x7f, 0x89, 0x01, 0xf0, 0x07, 0x84, 0x01, 0xfe,
+  0x00, 0x8a, 0x01, 0xf0, 0x07, 0x84, 0x01, 0xfe, 0x00, 0x8a, 0x01, 0xf0,
+  0x07, 0x84, 0x01, 0xfe, 0x00, 0x8a, 0x01, 0xf0, 0x07, 0x84, 0x01, 0xfe,
+  0x00, 0x8a, 0x01, 0xf0, 0x07, 0x84, 0x01, 0xfe, 0x00, 0x8a, 0x01, 0xf0,
+  0x07, 0x84, 0x01, 0xfe, 0x00, 0x82, 0x05, 0xfc, 0x1f, 0xff, 0x07, 0xff,
+  0xc1, 0x81, 0x01, 0xf0, 0x07, 0x84, 0x01, 0xfe, 0x00, 0x82, 0x05, 0xf8,
+  0x0f, 0xfe, 0x03, 0xff, 0x80, 0x81, 0x01, 0xf0, 0x07, 0x84, 0x01, 0xfe,
+  0x00, 0x82, 0x09, 0xf0, 0x07, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0xff, 0xf0,
+  0x07, 0x84, 0x01, 0xfe, 0x00, 0x82, 0x09, 0xf0, 0x07, 0xfc, 0x01, 0xff,
+  0x00, 0x7f, 0xff, 0xf0, 0x07, 0x84, 0x02, 0xfe, 0x00, 0x7f, 0x81, 0x09,
+  0xf0, 0x07, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0xff, 0xf0, 0x07, 0x84, 0x02,
+  0xfe, 0x00, 0x7f, 0x81, 0x09, 0xf0, 0x07, 0xfc, 0x01, 0xff, 0x00, 0x7f,
+  0xff, 0xe0, 0x07, 0x85, 0xc0, 0x00, 0x7f, 0x81, 0x09, 0xe0, 0x07, 0xf8,
+  0x01, 0xfe, 0x00, 0x7f, 0xff, 0xe0, 0x0f, 0x85, 0xc0, 0x00, 0x3f, 0x81,
+  0x05, 0xe0, 0x0f, 0xf8, 0x03, 0xfe, 0x00, 0x81, 0x01, 0xc0, 0x0f, 0x85,
+  0xc0, 0x00, 0x1f, 0x81, 0x05, 0xe0, 0x0f, 0xf8, 0x03, 0xfe, 0x00, 0x81,
+  0x01, 0xc0, 0x0f, 0x85, 0x01, 0x80, 0x1f, 0x81, 0x05, 0xe0, 0x0f, 0xf8,
+  0x03, 0xfe, 0x00, 0x81, 0x01, 0x80, 0x1f, 0x85, 0x01, 0x80, 0x0f, 0x81,
+  0x05, 0xc0, 0x0f, 0xf0, 0x03, 0xfc, 0x01, 0x81, 0xc0, 0x00, 0x1f, 0x85,
+  0x01, 0xc0, 0x07, 0x81, 0x09, 0xc0, 0x1f, 0xf0, 0x07, 0xfc, 0x01, 0xff,
+  0xfe, 0x00, 0x3f, 0x85, 0x01, 0xc0, 0x03, 0x81, 0x09, 0xc0, 0x1f, 0xf0,
+  0x07, 0xfc, 0x01, 0xff, 0xfc, 0x00, 0x3f, 0x85, 0x01, 0xe0, 0x01, 0x81,
+  0x09, 0xc0, 0x1f, 0xe0, 0x07, 0xfc, 0x01, 0xff, 0xf8, 0x00, 0x7f, 0x85,
+  0x0d, 0xf0, 0x00, 0x7f, 0xff, 0x80, 0x1f, 0xe0, 0x0f, 0xf8, 0x03, 0xff,
+  0xe0, 0x00, 0x7f, 0x85, 0x0c, 0xf0, 0x00, 0x1f, 0xff, 0x80, 0x3f, 0xe0,
+  0x0f, 0xf8, 0x03, 0xff, 0x80, 0x00, 0x86, 0x0c, 0xf8, 0x00, 0x01, 0xff,
+  0x80, 0x3f, 0xe0, 0x0f, 0xf8, 0x03, 0xf8, 0x00, 0x01, 0x86, 0x00, 0xfc,
+  0xc1, 0x09, 0x7f, 0x00, 0x3f, 0xc0, 0x0f, 0xf0, 0x03, 0xe0, 0x00, 0x03,
+  0x86, 0x00, 0xfe, 0xc1, 0x09, 0x7f, 0x00, 0x3f, 0xc0, 0x1f, 0xf0, 0x07,
+  0xe0, 0x00, 0x07, 0x87, 0xc1, 0x09, 0x7f, 0x00, 0x7f, 0xc0, 0x1f, 0xf0,
+  0x07, 0xe0, 0x00, 0x0f, 0x87, 0x0b, 0xc0, 0x00, 0x7f, 0x00, 0x7f, 0xc0,
+  0x1f, 0xf0, 0x07, 0xe0, 0x00, 0x1f, 0x87, 0x0b, 0xe0, 0x00, 0x7e, 0x00,
+  0x7f, 0x80, 0x1f, 0xe0, 0x07, 0xe0, 0x00, 0x7f, 0x87, 0x0a, 0xf8, 0x00,
+  0x7e, 0x00, 0x7f, 0x80, 0x3f, 0xe0, 0x0f, 0xe0, 0x01, 0x88, 0x0a, 0xfe,
+  0x00, 0x7e, 0x00, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xe0, 0x07, 0x89, 0x09,
+  0xc0, 0x7e, 0x00, 0xff, 0x80, 0x3f, 0xe0, 0x0f, 0xe0, 0x3f, 0x89, 0x07,
+  0xfe, 0x7c, 0x00, 0xff, 0x00, 0x3f, 0xc0, 0x0f, 0x8c, 0x06, 0xfc, 0x00,
+  0xff, 0x00, 0x7f, 0xc0, 0x1f, 0x8c, 0x06, 0xfc, 0x01, 0xff, 0x00, 0x7f,
+  0xc0, 0x1f, 0x8c, 0x06, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0xc0, 0x1f, 0x8c,
+  0x06, 0xf8, 0x01, 0xfe, 0x00, 0x7f, 0x80, 0x1f, 0x8c, 0x06, 0xf8, 0x03,
+  0xfe, 0x00, 0xff, 0x80, 0x3f, 0x8c, 0x06, 0xf8, 0x03, 0xfe, 0x00, 0xff,
+  0x80, 0x3f, 0x8c, 0x06, 0xf0, 0x03, 0xfc, 0x00, 0xff, 0x00, 0x3f, 0x8c,
+  0x06, 0xf0, 0x03, 0xfc, 0x01, 0xff, 0x00, 0x7f, 0x8c, 0x06, 0xf0, 0x07,
+  0xfc, 0x01, 0xff, 0x00, 0x7f, 0x8c, 0x06, 0xf0, 0x07, 0xfc, 0x01, 0xff,
+  0x00, 0x7f, 0x8c, 0x06, 0xf0, 0x07, 0xf8, 0x01, 0xff, 0x00, 0x7f, 0x8c,
+  0x05, 0xf8, 0x0f, 0xf8, 0x03, 0xff, 0x80, 0x8d, 0x05, 0xfc, 0x1f, 0xf8,
+  0x03, 0xff, 0xc1, 0x8f, 0x01, 0xf8, 0x03, 0x91, 0x01, 0xf0, 0x03, 0x91,
+  0x01, 0xf0, 0x07, 0x91, 0x01, 0xf0, 0x07, 0x91, 0x01, 0xf0, 0x07, 0x91,
+  0x01, 0xe0, 0x07, 0x91, 0x01, 0xe0, 0x0f, 0x91, 0x01, 0xe0, 0x0f, 0x91,
+  0x01, 0xe0, 0x0f, 0x91, 0x01, 0xc0, 0x0f, 0x91, 0x01, 0xc0, 0x1f, 0x91,
+  0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0, 0x1f, 0x91, 0x01, 0xc0, 0x3f, 0x91,
+  0x01, 0xc0, 0x3f, 0x91, 0x01, 0xe0, 0x7f, 0x91, 0x00, 0xf9, 0xbf, 0xbf,
+  0xbf, 0xbf, 0x8e
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char air_filter_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xfb, 0xdf, 0xfb, 0xdf,
-  0xfb, 0x07, 0xfb, 0xdf, 0xfb, 0x87, 0xfb, 0x5f, 0xfb, 0x87, 0xfb, 0xdf,
-  0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x13, 0xf8, 0x1f, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0x07, 0xfb, 0xdf,
+  0xfb, 0x87, 0xfb, 0x5f, 0xfb, 0x87, 0xfb, 0xdf, 0xf8, 0x1f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char battery_3_bar_180deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f,
+  0x81, 0x1b, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f,
   0xf8, 0x1f, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf,
-  0xf8, 0x1f, 0xfc, 0x3f, 0xfe, 0x7f, 0xff, 0xff
+  0xf8, 0x1f, 0xfc, 0x3f, 0xfe, 0x7f, 0x81
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char battery_charging_full_270deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01,
-  0xc0, 0x81, 0x83, 0xe1, 0x81, 0xf1, 0xc0, 0x41, 0xe0, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x0b, 0xe0, 0x01, 0xc0, 0x81, 0x83, 0xe1, 0x81, 0xf1, 0xc0, 0x41,
+  0xe0, 0x01, 0x89
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char biological_hazard_symbol_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0xfb, 0xdf,
-  0xf8, 0x9f, 0xf0, 0x0f, 0xf9, 0x9f, 0xfa, 0x5f, 0xfa, 0x5f, 0xfe, 0x7f,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x11, 0xfb, 0xdf, 0xfb, 0xdf, 0xf8, 0x9f, 0xf0, 0x0f, 0xf9, 0x9f,
+  0xfa, 0x5f, 0xfa, 0x5f, 0xfe, 0x7f, 0xfc, 0x3f, 0x85
 };
\ No newline at end of file
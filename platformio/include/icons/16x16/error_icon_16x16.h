@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char error_icon_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf3, 0xcf, 0xf7, 0xef,
-  0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xf7, 0xef, 0xf3, 0xcf,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x13, 0xfc, 0x3f, 0xf3, 0xcf, 0xf7, 0xef, 0xef, 0xf7, 0xef, 0xf7,
+  0xef, 0xf7, 0xef, 0xf7, 0xf7, 0xef, 0xf3, 0xcf, 0xfc, 0x3f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char house_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xf9, 0x8f, 0xf3, 0xcf,
-  0xe7, 0xe7, 0xcf, 0xf3, 0xcf, 0xf3, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7,
-  0xef, 0xf7, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x15, 0xfc, 0x2f, 0xf9, 0x8f, 0xf3, 0xcf, 0xe7, 0xe7, 0xcf, 0xf3,
+  0xcf, 0xf3, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xf0, 0x0f,
+  0x83
 };
\ No newline at end of file
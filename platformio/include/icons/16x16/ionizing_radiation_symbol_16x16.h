@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char ionizing_radiation_symbol_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xf3, 0xcf, 0xe1, 0x87,
-  0xe1, 0x87, 0xe2, 0x47, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xfc, 0x3f,
-  0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x13, 0xf3, 0xcf, 0xf3, 0xcf, 0xe1, 0x87, 0xe1, 0x87, 0xe2, 0x47,
+  0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf8, 0x1f, 0x85
 };
\ No newline at end of file
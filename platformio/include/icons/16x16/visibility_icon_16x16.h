@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char visibility_icon_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xf8, 0x1f,
-  0xf3, 0xcf, 0xe2, 0x47, 0xe2, 0x47, 0xf3, 0xcf, 0xf8, 0x1f, 0xfe, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0f, 0xfe, 0x7f, 0xf8, 0x1f, 0xf3, 0xcf, 0xe2, 0x47, 0xe2, 0x47,
+  0xf3, 0xcf, 0xf8, 0x1f, 0xfe, 0x7f, 0x87
 };
\ No newline at end of file
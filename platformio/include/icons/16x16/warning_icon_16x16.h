@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char warning_icon_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0xbf,
-  0xfb, 0xdf, 0xfb, 0xdf, 0xf7, 0xef, 0xff, 0xff, 0xef, 0xf7, 0xdf, 0xfb,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x0b, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0xbf, 0xfb, 0xdf, 0xfb, 0xdf,
+  0xf7, 0xef, 0x81, 0x05, 0xef, 0xf7, 0xdf, 0xfb, 0xe0, 0x07, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_alien_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0x1f, 0xf8, 0x0f,
-  0xf0, 0x0f, 0xfe, 0x7f, 0xff, 0x7f, 0xfb, 0x5f, 0xfc, 0x3f, 0xfe, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x11, 0xfe, 0x3f, 0xf8, 0x1f, 0xf8, 0x0f, 0xf0, 0x0f, 0xfe, 0x7f,
+  0xff, 0x7f, 0xfb, 0x5f, 0xfc, 0x3f, 0xfe, 0x7f, 0x87
 };
\ No newline at end of file
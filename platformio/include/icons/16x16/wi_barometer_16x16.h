@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_barometer_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0x9f, 0xf7, 0xef,
-  0xf7, 0x6f, 0xf7, 0x6f, 0xf7, 0xef, 0xfb, 0xdf, 0xfc, 0x3f, 0xfe, 0x7f,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x13, 0xfc, 0x3f, 0xfb, 0x9f, 0xf7, 0xef, 0xf7, 0x6f, 0xf7, 0x6f,
+  0xf7, 0xef, 0xfb, 0xdf, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_celsius_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x5f,
-  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x02, 0xf9, 0x5f, 0xfd, 0x85, 0x00, 0x3f, 0x8b
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloud_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xcf, 0xef, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf7, 0xf0, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x07, 0xfc, 0x7f, 0xfb, 0xbf, 0xf7, 0xcf, 0xef, 0xf7, 0x83, 0x03,
+  0xef, 0xf7, 0xf0, 0x0f, 0x87
 };
\ No newline at end of file
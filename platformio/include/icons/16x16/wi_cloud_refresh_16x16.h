@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloud_refresh_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf3, 0xcf, 0xee, 0x77, 0xec, 0x7f, 0xed, 0xff, 0xed, 0xb7, 0xf6, 0x6f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0f, 0xfc, 0x7f, 0xfb, 0xbf, 0xf3, 0xcf, 0xee, 0x77, 0xec, 0x7f,
+  0xed, 0xff, 0xed, 0xb7, 0xf6, 0x6f, 0x87
 };
\ No newline at end of file
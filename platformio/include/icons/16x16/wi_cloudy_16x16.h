@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloudy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xf8, 0xef,
-  0xf7, 0x77, 0xe7, 0x3b, 0xdf, 0xdb, 0xdf, 0xe7, 0xdf, 0xdf, 0xf0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x88, 0x0e, 0x1f, 0xf8, 0xef, 0xf7, 0x77, 0xe7, 0x3b, 0xdf, 0xdb, 0xdf,
+  0xe7, 0xdf, 0xdf, 0xf0, 0x3f, 0x87
 };
\ No newline at end of file
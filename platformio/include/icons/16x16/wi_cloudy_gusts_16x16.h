@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloudy_gusts_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf9, 0xdf,
-  0xfb, 0xcf, 0xe6, 0x73, 0xff, 0x7b, 0xc0, 0x7b, 0xff, 0xf3, 0xc3, 0x0f,
-  0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x12, 0xfc, 0x3f, 0xf9, 0xdf, 0xfb, 0xcf, 0xe6, 0x73, 0xff, 0x7b,
+  0xc0, 0x7b, 0xff, 0xf3, 0xc3, 0x0f, 0xf9, 0xff, 0xfb, 0x84
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloudy_windy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfd, 0xdf,
-  0xfb, 0xef, 0xf7, 0xf3, 0xff, 0xfb, 0xe0, 0x7b, 0xff, 0xf3, 0xc1, 0x0f,
-  0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x11, 0xfe, 0x3f, 0xfd, 0xdf, 0xfb, 0xef, 0xf7, 0xf3, 0xff, 0xfb,
+  0xe0, 0x7b, 0xff, 0xf3, 0xc1, 0x0f, 0xf0, 0x7f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_cloudy_gusts_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xdf, 0xfd, 0xfb, 0xff, 0x9f, 0xf8, 0x6f, 0xf7, 0x77,
-  0xe7, 0x95, 0xdd, 0xe7, 0xfe, 0xff, 0x00, 0xfb, 0xff, 0xef, 0x84, 0x1f,
-  0xf7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x17, 0xdf, 0xfd, 0xfb, 0xff, 0x9f, 0xf8, 0x6f, 0xf7, 0x77, 0xe7,
+  0x95, 0xdd, 0xe7, 0xfe, 0xff, 0x00, 0xfb, 0xff, 0xef, 0x84, 0x1f, 0xf7,
+  0xff, 0xef, 0x84
 };
\ No newline at end of file
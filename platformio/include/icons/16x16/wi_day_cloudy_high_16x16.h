@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_cloudy_high_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf7, 0x7f, 0xef, 0x3f,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0x2b, 0xfe, 0xdf, 0xff, 0x3f, 0xfd, 0xff,
-  0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x10, 0xf8, 0xff, 0xf7, 0x7f, 0xef, 0x3f, 0xdf, 0xdf, 0xdf, 0xdf,
+  0xe0, 0x2b, 0xfe, 0xdf, 0xff, 0x3f, 0xfd, 0x81, 0x00, 0xbf, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_cloudy_windy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xdf, 0xfd, 0xfb, 0xff, 0xdf, 0xf8, 0x6f, 0xf7, 0x77,
-  0xef, 0xb5, 0xdf, 0xef, 0xff, 0xef, 0x81, 0xeb, 0xff, 0xef, 0x84, 0x1f,
-  0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x15, 0xdf, 0xfd, 0xfb, 0xff, 0xdf, 0xf8, 0x6f, 0xf7, 0x77, 0xef,
+  0xb5, 0xdf, 0xef, 0xff, 0xef, 0x81, 0xeb, 0xff, 0xef, 0x84, 0x1f, 0xc1,
+  0x86
 };
\ No newline at end of file
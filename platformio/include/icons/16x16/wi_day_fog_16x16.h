@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_fog_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xdf, 0xfd, 0xfb, 0xff, 0xdf, 0xf8, 0x6f, 0xf7, 0x77,
-  0xe7, 0x95, 0xdf, 0xe7, 0xff, 0xff, 0xc0, 0x0b, 0xff, 0xff, 0x80, 0x1f,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x0c, 0xdf, 0xfd, 0xfb, 0xff, 0xdf, 0xf8, 0x6f, 0xf7, 0x77, 0xe7,
+  0x95, 0xdf, 0xe7, 0x81, 0x01, 0xc0, 0x0b, 0x81, 0x03, 0x80, 0x1f, 0xe0,
+  0x07, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_haze_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xff,
-  0xfc, 0x3f, 0xf9, 0x9f, 0xef, 0xf7, 0xf0, 0xcf, 0xff, 0xff, 0xfc, 0x9f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x01, 0xf7, 0xef, 0x81, 0x07, 0xfc, 0x3f, 0xf9, 0x9f, 0xef, 0xf7,
+  0xf0, 0xcf, 0x81, 0x01, 0xfc, 0x9f, 0x87
 };
\ No newline at end of file
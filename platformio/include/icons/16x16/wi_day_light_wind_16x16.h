@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_light_wind_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfb, 0xf7, 0xff, 0x3f, 0xfe, 0xdf, 0xfd, 0xef,
-  0xf7, 0xeb, 0xc1, 0xdf, 0xff, 0x9f, 0xc0, 0xf7, 0xff, 0xbf, 0xc1, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x13, 0xbf, 0xfb, 0xf7, 0xff, 0x3f, 0xfe, 0xdf, 0xfd, 0xef, 0xf7,
+  0xeb, 0xc1, 0xdf, 0xff, 0x9f, 0xc0, 0xf7, 0xff, 0xbf, 0xc1, 0x88
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_lightning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfb, 0xff, 0xff, 0xb7, 0xf0, 0x4f, 0xee, 0x6f,
-  0xef, 0x2d, 0x9f, 0xcf, 0xbd, 0xef, 0xbd, 0xef, 0x99, 0xdf, 0xf9, 0xff,
-  0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x01, 0xbf, 0xfb, 0x81, 0x13, 0xb7, 0xf0, 0x4f, 0xee, 0x6f, 0xef,
+  0x2d, 0x9f, 0xcf, 0xbd, 0xef, 0xbd, 0xef, 0x99, 0xdf, 0xf9, 0xff, 0xfd,
+  0xff, 0xfb, 0x84
 };
\ No newline at end of file
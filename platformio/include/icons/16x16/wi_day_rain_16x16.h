@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_rain_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfb, 0xfb, 0xff, 0xb7, 0xf0, 0x4f, 0xee, 0x6f,
-  0xef, 0x2d, 0x9f, 0xcf, 0xbf, 0xef, 0xbd, 0x6f, 0x95, 0x5f, 0xf5, 0x7f,
-  0xf6, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff
+  0x82, 0x19, 0xbf, 0xfb, 0xfb, 0xff, 0xb7, 0xf0, 0x4f, 0xee, 0x6f, 0xef,
+  0x2d, 0x9f, 0xcf, 0xbf, 0xef, 0xbd, 0x6f, 0x95, 0x5f, 0xf5, 0x7f, 0xf6,
+  0xff, 0xfb, 0xff, 0xfb, 0x82
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_sunny_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xfd, 0xbf, 0xeb, 0xd7, 0xfb, 0xdf, 0xfd, 0xbf, 0xfe, 0x7f, 0xf7, 0xef,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0f, 0xf7, 0xef, 0xfe, 0x7f, 0xfd, 0xbf, 0xeb, 0xd7, 0xfb, 0xdf,
+  0xfd, 0xbf, 0xfe, 0x7f, 0xf7, 0xef, 0x87
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_windy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfd, 0xfb, 0xfd, 0xb7, 0xfe, 0x4f, 0xfe, 0xef,
-  0xf7, 0xed, 0xfc, 0xef, 0xfe, 0x9f, 0x80, 0xf7, 0xff, 0xbf, 0x83, 0xbf,
-  0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x17, 0xbf, 0xfd, 0xfb, 0xfd, 0xb7, 0xfe, 0x4f, 0xfe, 0xef, 0xf7,
+  0xed, 0xfc, 0xef, 0xfe, 0x9f, 0x80, 0xf7, 0xff, 0xbf, 0x83, 0xbf, 0xfb,
+  0xff, 0xf7, 0x84
 };
\ No newline at end of file
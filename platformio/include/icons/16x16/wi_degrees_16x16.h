@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_degrees_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x02, 0xfe, 0x7f, 0xfe, 0x94
 };
\ No newline at end of file
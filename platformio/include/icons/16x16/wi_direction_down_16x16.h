@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_down_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8f, 0x03, 0xfe, 0x7f, 0xfe, 0x7f, 0x8b
 };
\ No newline at end of file
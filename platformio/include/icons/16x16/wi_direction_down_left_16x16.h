@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_down_left_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xbf, 0xfd, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8c, 0x03, 0xbf, 0xfd, 0x7f, 0xfc, 0x8e
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_down_right_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff,
-  0xfc, 0xff, 0xfe, 0x1f, 0xff, 0x1f, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x09, 0xf9, 0xff, 0xfc, 0xff, 0xfe, 0x1f, 0xff, 0x1f, 0xfe, 0x1f,
+  0x8b
 };
\ No newline at end of file
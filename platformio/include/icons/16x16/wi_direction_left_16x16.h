@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_left_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-  0xf9, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x0a, 0xfd, 0xff, 0xf9, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xf9, 0xff,
+  0xfd, 0x8a
 };
\ No newline at end of file
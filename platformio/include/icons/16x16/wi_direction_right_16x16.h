@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_right_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xbf, 0xfc, 0x1f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8c, 0x04, 0xbf, 0xfc, 0x1f, 0xff, 0xbf, 0x8d
 };
\ No newline at end of file
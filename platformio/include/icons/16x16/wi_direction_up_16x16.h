@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_up_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x1f,
-  0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x0f, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x1f, 0xfe, 0x7f, 0xfe, 0x7f,
+  0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x89
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_up_left_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-  0xf8, 0xff, 0xfa, 0x7f, 0xff, 0x3f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x09, 0xf8, 0x7f, 0xf8, 0xff, 0xfa, 0x7f, 0xff, 0x3f, 0xff, 0xbf,
+  0x8b
 };
\ No newline at end of file
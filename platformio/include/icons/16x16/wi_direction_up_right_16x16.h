@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_up_right_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-  0xff, 0x1f, 0xfe, 0x5f, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x08, 0xfe, 0x1f, 0xff, 0x1f, 0xfe, 0x5f, 0xfc, 0xff, 0xfd, 0x8c
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_earthquake_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf,
-  0xfa, 0xbf, 0xf6, 0x7f, 0xfd, 0x4f, 0xfd, 0xdf, 0xfd, 0xdf, 0xfd, 0xdf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x11, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfa, 0xbf, 0xf6, 0x7f,
+  0xfd, 0x4f, 0xfd, 0xdf, 0xfd, 0xdf, 0xfd, 0xdf, 0x87
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_fire_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xbf,
-  0xf8, 0x1f, 0xfc, 0x1f, 0xf0, 0x1f, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0b, 0xfc, 0xff, 0xfc, 0xbf, 0xf8, 0x1f, 0xfc, 0x1f, 0xf0, 0x1f,
+  0xf8, 0x1f, 0x81, 0x01, 0xf0, 0x0f, 0x87
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_fog_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0x9f,
-  0xfb, 0xcf, 0xe7, 0xf7, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xc0, 0x0f,
-  0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x07, 0xfc, 0x3f, 0xfb, 0x9f, 0xfb, 0xcf, 0xe7, 0xf7, 0x81, 0x01,
+  0xe0, 0x07, 0x81, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0x85
 };
\ No newline at end of file
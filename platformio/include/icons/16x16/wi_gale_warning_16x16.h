@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_gale_warning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0x3f,
-  0xfc, 0x3f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0e, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0xff, 0xfc, 0xff,
+  0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x88
 };
\ No newline at end of file
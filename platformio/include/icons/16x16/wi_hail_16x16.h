@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_hail_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xdf, 0xef, 0xf7, 0xef, 0xf7, 0xed, 0x5f, 0xed, 0x77, 0xf6, 0xef,
-  0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x11, 0xfc, 0x7f, 0xfb, 0xbf, 0xf7, 0xdf, 0xef, 0xf7, 0xef, 0xf7,
+  0xed, 0x5f, 0xed, 0x77, 0xf6, 0xef, 0xfe, 0xbf, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_horizon_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf7, 0xef, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff, 0xe0, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8d, 0x05, 0xf7, 0xef, 0xfc, 0x3f, 0xfb, 0xdf, 0x81, 0x01, 0xe0, 0x07,
+  0x87
 };
\ No newline at end of file
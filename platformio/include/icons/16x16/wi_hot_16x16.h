@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_hot_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xfd, 0xbf, 0xeb, 0xd7, 0xff, 0xff, 0xfa, 0xbf, 0xf9, 0x5f, 0xfd, 0x5f,
-  0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x07, 0xf7, 0xef, 0xfe, 0x7f, 0xfd, 0xbf, 0xeb, 0xd7, 0x81, 0x07,
+  0xfa, 0xbf, 0xf9, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_humidity_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f,
-  0xfa, 0x5f, 0xf4, 0x9f, 0xf6, 0x8f, 0xf1, 0x6f, 0xf1, 0x6f, 0xf8, 0x5f,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x13, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xfa, 0x5f, 0xf4, 0x9f,
+  0xf6, 0x8f, 0xf1, 0x6f, 0xf1, 0x6f, 0xf8, 0x5f, 0xfc, 0x3f, 0x85
 };
\ No newline at end of file
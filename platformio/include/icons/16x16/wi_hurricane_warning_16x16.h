@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_hurricane_warning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xf1, 0x3f,
-  0xf0, 0x3f, 0xf4, 0x7f, 0xf0, 0x3f, 0xf3, 0x3f, 0xf0, 0x3f, 0xf7, 0xff,
-  0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x10, 0xf0, 0x3f, 0xf1, 0x3f, 0xf0, 0x3f, 0xf4, 0x7f, 0xf0, 0x3f,
+  0xf3, 0x3f, 0xf0, 0x3f, 0xf7, 0xff, 0xf7, 0x86
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_lightning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x9f, 0xf8, 0x9f,
-  0xf9, 0xdf, 0xf9, 0xff, 0xf8, 0xbf, 0xfd, 0xff, 0xfb, 0xff, 0xfb, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x0f, 0xdf, 0xfc, 0x9f, 0xf8, 0x9f, 0xf9, 0xdf, 0xf9, 0xff, 0xf8,
+  0xbf, 0xfd, 0xff, 0xfb, 0xff, 0xfb, 0x88
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_lunar_eclipse_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-  0xfc, 0x3f, 0xf8, 0x5f, 0xf8, 0x5f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x09, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x5f, 0xf8, 0x5f, 0xfc, 0x3f,
+  0x8b
 };
\ No newline at end of file
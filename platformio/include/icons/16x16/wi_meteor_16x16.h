@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_meteor_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xfe, 0x1f,
-  0xfc, 0x1f, 0xf8, 0x1f, 0xfa, 0x1f, 0xf7, 0x3f, 0xff, 0xff, 0xf7, 0x7f,
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x0c, 0xdf, 0xff, 0xbf, 0xfe, 0x1f, 0xfc, 0x1f, 0xf8, 0x1f, 0xfa,
+  0x1f, 0xf7, 0x3f, 0x81, 0x02, 0xf7, 0x7f, 0xf8, 0x86
 };
\ No newline at end of file
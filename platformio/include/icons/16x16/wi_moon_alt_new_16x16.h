@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_new_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03,
-  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07,
-  0xf0, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f,
+  0xfe, 0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_third_quarter_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x1f, 0xf7, 0x0f, 0xef, 0x07, 0xdf, 0x03,
-  0xdf, 0x03, 0xdf, 0x03, 0xdf, 0x03, 0xdf, 0x03, 0xff, 0x07, 0xef, 0x07,
-  0xf3, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf9, 0x1f, 0xf7, 0x0f, 0xef, 0x07, 0xdf, 0x03, 0xdf, 0x03,
+  0xdf, 0x03, 0xdf, 0x03, 0xdf, 0x03, 0xff, 0x07, 0xef, 0x07, 0xf3, 0x0f,
+  0xfe, 0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waning_gibbous_3_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x1f, 0xf7, 0x8f, 0xef, 0xc7, 0xdf, 0xc3,
-  0xdf, 0xc3, 0xdf, 0xc3, 0xdf, 0xc3, 0xdf, 0xc3, 0xff, 0xc7, 0xef, 0xc7,
-  0xf3, 0x8f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf9, 0x1f, 0xf7, 0x8f, 0xef, 0xc7, 0xdf, 0xc3, 0xdf, 0xc3,
+  0xdf, 0xc3, 0xdf, 0xc3, 0xdf, 0xc3, 0xff, 0xc7, 0xef, 0xc7, 0xf3, 0x8f,
+  0xfe, 0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waxing_gibbous_2_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x9f, 0xf1, 0xef, 0xe1, 0xf7, 0xc1, 0xfb,
-  0xc3, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xe1, 0xff, 0xe1, 0xf7,
-  0xf1, 0xcf, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf8, 0x9f, 0xf1, 0xef, 0xe1, 0xf7, 0xc1, 0xfb, 0xc3, 0xfb,
+  0xc3, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xe1, 0xff, 0xe1, 0xf7, 0xf1, 0xcf,
+  0xfe, 0x7f, 0x83
 };
\ No newline at end of file
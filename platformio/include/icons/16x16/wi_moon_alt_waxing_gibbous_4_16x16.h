@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waxing_gibbous_4_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xf3, 0xef, 0xe3, 0xf7, 0xc7, 0xfb,
-  0xc7, 0xfb, 0xc7, 0xfb, 0xc7, 0xfb, 0xc7, 0xfb, 0xe7, 0xff, 0xe3, 0xf7,
-  0xf1, 0xcf, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf9, 0x9f, 0xf3, 0xef, 0xe3, 0xf7, 0xc7, 0xfb, 0xc7, 0xfb,
+  0xc7, 0xfb, 0xc7, 0xfb, 0xc7, 0xfb, 0xe7, 0xff, 0xe3, 0xf7, 0xf1, 0xcf,
+  0xfe, 0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_new_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xf7, 0xef, 0xef, 0xf7, 0xdf, 0xfb,
-  0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xff, 0xff, 0xef, 0xf7,
-  0xf3, 0xcf, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x0f, 0xf9, 0x9f, 0xf7, 0xef, 0xef, 0xf7, 0xdf, 0xfb, 0xdf, 0xfb,
+  0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0x81, 0x05, 0xef, 0xf7, 0xf3, 0xcf,
+  0xfe, 0x7f, 0x83
 };
\ No newline at end of file
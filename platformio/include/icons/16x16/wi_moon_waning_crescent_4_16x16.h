@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waning_crescent_4_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xe3, 0xff, 0xc7, 0xff,
-  0xc7, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xe7, 0xff, 0xe3, 0xff,
-  0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x14, 0xf9, 0xff, 0xf3, 0xff, 0xe3, 0xff, 0xc7, 0xff, 0xc7, 0xff,
+  0xc7, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xe7, 0xff, 0xe3, 0xff, 0xf3, 0x86
 };
\ No newline at end of file
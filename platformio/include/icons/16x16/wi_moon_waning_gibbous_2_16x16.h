@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waning_gibbous_2_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xf0, 0x3f, 0xe0, 0x1f, 0xc0, 0x1f,
-  0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f,
-  0xf0, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x16, 0xf8, 0x7f, 0xf0, 0x3f, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f,
+  0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xf0, 0x3f,
+  0xfc, 0x84
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_crescent_1_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xf3,
-  0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xe7,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x84, 0x14, 0x9f, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xf3, 0xff, 0xf3, 0xff,
+  0xf3, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xe7, 0xff, 0xcf, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_crescent_4_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x8f, 0xff, 0xc7, 0xff, 0xc3,
-  0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc7, 0xff, 0x87,
-  0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x84, 0x14, 0x9f, 0xff, 0x8f, 0xff, 0xc7, 0xff, 0xc3, 0xff, 0xc3, 0xff,
+  0xc3, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc7, 0xff, 0x87, 0xff, 0x8f, 0x85
 };
\ No newline at end of file
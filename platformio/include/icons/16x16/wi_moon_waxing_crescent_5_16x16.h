@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_crescent_5_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x8f, 0xff, 0x87, 0xff, 0x83,
-  0xff, 0x83, 0xff, 0x83, 0xff, 0x83, 0xff, 0x83, 0xff, 0x87, 0xff, 0x87,
-  0xff, 0x8f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x84, 0x16, 0x1f, 0xff, 0x8f, 0xff, 0x87, 0xff, 0x83, 0xff, 0x83, 0xff,
+  0x83, 0xff, 0x83, 0xff, 0x83, 0xff, 0x87, 0xff, 0x87, 0xff, 0x8f, 0xff,
+  0x7f, 0x83
 };
\ No newline at end of file
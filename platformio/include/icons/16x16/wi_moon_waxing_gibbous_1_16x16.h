@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_gibbous_1_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x0f, 0xff, 0x07, 0xff, 0x03,
-  0xfe, 0x03, 0xfe, 0x03, 0xfe, 0x03, 0xfe, 0x03, 0xff, 0x07, 0xff, 0x07,
-  0xff, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x84, 0x16, 0x1f, 0xff, 0x0f, 0xff, 0x07, 0xff, 0x03, 0xfe, 0x03, 0xfe,
+  0x03, 0xfe, 0x03, 0xfe, 0x03, 0xff, 0x07, 0xff, 0x07, 0xff, 0x0f, 0xff,
+  0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_gibbous_5_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xfc, 0x0f, 0xfc, 0x07, 0xf8, 0x03,
-  0xf8, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xfc, 0x07, 0xfc, 0x07,
-  0xfe, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xfe, 0x1f, 0xfc, 0x0f, 0xfc, 0x07, 0xf8, 0x03, 0xf8, 0x03,
+  0xf8, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xfc, 0x07, 0xfc, 0x07, 0xfe, 0x0f,
+  0xff, 0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moonrise_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0x7f,
-  0xf3, 0xbf, 0xf7, 0xcf, 0xf7, 0xef, 0xfe, 0x7f, 0xfc, 0x3f, 0xf9, 0x9f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0f, 0xfc, 0x7f, 0xfb, 0x7f, 0xf3, 0xbf, 0xf7, 0xcf, 0xf7, 0xef,
+  0xfe, 0x7f, 0xfc, 0x3f, 0xf9, 0x9f, 0x87
 };
\ No newline at end of file
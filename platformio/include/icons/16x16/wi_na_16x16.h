@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_na_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf5, 0x5f, 0xf1, 0x0f, 0xf1, 0x8f, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8b, 0x07, 0xf5, 0x5f, 0xf1, 0x0f, 0xf1, 0x8f, 0xf4, 0xaf, 0x8b
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_cloudy_gusts_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xfc, 0x37, 0xfb, 0x93,
-  0xfb, 0xcb, 0xe6, 0x73, 0xff, 0x7b, 0xc0, 0x7b, 0xff, 0xf7, 0xc3, 0x0f,
-  0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x13, 0xc7, 0xfc, 0x37, 0xfb, 0x93, 0xfb, 0xcb, 0xe6, 0x73, 0xff,
+  0x7b, 0xc0, 0x7b, 0xff, 0xf7, 0xc3, 0x0f, 0xfb, 0xff, 0xfb, 0x84
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_partly_cloudy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0xbf,
-  0xfd, 0xdf, 0xfc, 0xcf, 0xfb, 0x6f, 0xf3, 0x9f, 0xf7, 0xdf, 0xf0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x88, 0x0e, 0x3f, 0xfe, 0xbf, 0xfd, 0xdf, 0xfc, 0xcf, 0xfb, 0x6f, 0xf3,
+  0x9f, 0xf7, 0xdf, 0xf0, 0x1f, 0x87
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_rain_mix_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfc, 0x2f, 0xfb, 0xb7,
-  0xf7, 0x93, 0xef, 0xe7, 0xdf, 0xf7, 0xdd, 0xf7, 0xef, 0xe7, 0xfe, 0xff,
-  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x11, 0x8f, 0xfc, 0x2f, 0xfb, 0xb7, 0xf7, 0x93, 0xef, 0xe7, 0xdf,
+  0xf7, 0xdd, 0xf7, 0xef, 0xe7, 0xfe, 0xff, 0xfb, 0x86
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_thunderstorm_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfc, 0x2f, 0xfb, 0xb7,
-  0xf7, 0x93, 0xef, 0xe7, 0xdf, 0xf7, 0xd9, 0x77, 0xe2, 0xa7, 0xf2, 0xbf,
-  0xf2, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x13, 0x8f, 0xfc, 0x2f, 0xfb, 0xb7, 0xf7, 0x93, 0xef, 0xe7, 0xdf,
+  0xf7, 0xd9, 0x77, 0xe2, 0xa7, 0xf2, 0xbf, 0xf2, 0xbf, 0xfe, 0x84
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_cloudy_high_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf3, 0x3f, 0xf7, 0xbf, 0xef, 0xef,
-  0xdf, 0xf7, 0xdf, 0xf7, 0xcf, 0xe3, 0xe0, 0x0b, 0xff, 0x7b, 0xff, 0xb3,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x15, 0xfc, 0x7f, 0xf3, 0x3f, 0xf7, 0xbf, 0xef, 0xef, 0xdf, 0xf7,
+  0xdf, 0xf7, 0xcf, 0xe3, 0xe0, 0x0b, 0xff, 0x7b, 0xff, 0xb3, 0xff, 0xcf,
+  0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_cloudy_windy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x1b, 0xfd, 0xdd,
-  0xfb, 0xed, 0xf7, 0xf3, 0xff, 0xfb, 0xe0, 0x7b, 0xff, 0xf3, 0xc1, 0x0f,
-  0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x12, 0xe7, 0xfe, 0x1b, 0xfd, 0xdd, 0xfb, 0xed, 0xf7, 0xf3, 0xff,
+  0xfb, 0xe0, 0x7b, 0xff, 0xf3, 0xc1, 0x0f, 0xf0, 0x7f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_fog_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xfc, 0x37, 0xfb, 0x93,
-  0xf3, 0xcb, 0xe7, 0xf3, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xc0, 0x0f,
-  0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x08, 0xc7, 0xfc, 0x37, 0xfb, 0x93, 0xf3, 0xcb, 0xe7, 0xf3, 0x81,
+  0x01, 0xe0, 0x07, 0x81, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0x85
 };
\ No newline at end of file
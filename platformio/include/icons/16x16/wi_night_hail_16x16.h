@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_hail_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc, 0x37, 0xfb, 0xbb,
-  0xf7, 0xdb, 0xef, 0xe7, 0xdf, 0xf7, 0xdd, 0x77, 0xec, 0xb7, 0xf6, 0xef,
-  0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x11, 0xcf, 0xfc, 0x37, 0xfb, 0xbb, 0xf7, 0xdb, 0xef, 0xe7, 0xdf,
+  0xf7, 0xdd, 0x77, 0xec, 0xb7, 0xf6, 0xef, 0xfa, 0x86
 };
\ No newline at end of file
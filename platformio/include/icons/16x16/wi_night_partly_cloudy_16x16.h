@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_partly_cloudy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xfc, 0xcf,
-  0xfd, 0xef, 0xfc, 0xef, 0xfb, 0x6f, 0xf3, 0x9f, 0xf7, 0xdf, 0xf0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0f, 0xfe, 0x1f, 0xfc, 0xcf, 0xfd, 0xef, 0xfc, 0xef, 0xfb, 0x6f,
+  0xf3, 0x9f, 0xf7, 0xdf, 0xf0, 0x1f, 0x87
 };
\ No newline at end of file
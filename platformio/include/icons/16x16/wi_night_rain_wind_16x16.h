@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_rain_wind_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc, 0x37, 0xfb, 0xbb,
-  0xf7, 0xdb, 0xef, 0xe7, 0xdf, 0xf7, 0xdf, 0xf7, 0xed, 0xf7, 0xf9, 0x4f,
-  0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x12, 0xcf, 0xfc, 0x37, 0xfb, 0xbb, 0xf7, 0xdb, 0xef, 0xe7, 0xdf,
+  0xf7, 0xdf, 0xf7, 0xed, 0xf7, 0xf9, 0x4f, 0xfe, 0xbf, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_sleet_storm_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc, 0x37, 0xfb, 0xbb,
-  0xf7, 0xdb, 0xef, 0xe7, 0xdf, 0xf7, 0xd9, 0xf7, 0xe3, 0xe7, 0xf2, 0xff,
-  0xf3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x12, 0xcf, 0xfc, 0x37, 0xfb, 0xbb, 0xf7, 0xdb, 0xef, 0xe7, 0xdf,
+  0xf7, 0xd9, 0xf7, 0xe3, 0xe7, 0xf2, 0xff, 0xf3, 0xbf, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_thunderstorm_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x37, 0xfb, 0xbb,
-  0xf7, 0xdb, 0xef, 0xe7, 0xdf, 0xf7, 0xd9, 0x77, 0xe3, 0xa7, 0xf2, 0xaf,
-  0xf2, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x13, 0xdf, 0xfc, 0x37, 0xfb, 0xbb, 0xf7, 0xdb, 0xef, 0xe7, 0xdf,
+  0xf7, 0xd9, 0x77, 0xe3, 0xa7, 0xf2, 0xaf, 0xf2, 0xbf, 0xfa, 0x84
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_rain_mix_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xdf, 0xef, 0xf7, 0xef, 0xf7, 0xed, 0xdf, 0xef, 0xf7, 0xf7, 0xef,
-  0xfb, 0xbf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff
+  0x87, 0x11, 0xfc, 0x7f, 0xfb, 0xbf, 0xf7, 0xdf, 0xef, 0xf7, 0xef, 0xf7,
+  0xed, 0xdf, 0xef, 0xf7, 0xf7, 0xef, 0xfb, 0xbf, 0x81, 0x00, 0xfe, 0x82
 };
\ No newline at end of file
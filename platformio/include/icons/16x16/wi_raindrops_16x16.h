@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_raindrops_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xfb, 0xff,
-  0xf1, 0xff, 0xf1, 0xbf, 0xff, 0x1f, 0xff, 0x1f, 0xfe, 0x0f, 0xfe, 0x0f,
-  0xff, 0x0f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x14, 0xbf, 0xff, 0x9f, 0xfb, 0xff, 0xf1, 0xff, 0xf1, 0xbf, 0xff,
+  0x1f, 0xff, 0x1f, 0xfe, 0x0f, 0xfe, 0x0f, 0xff, 0x0f, 0xff, 0xbf, 0x83
 };
\ No newline at end of file
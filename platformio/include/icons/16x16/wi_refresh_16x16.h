@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_refresh_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-  0xfc, 0x7f, 0xfb, 0xff, 0xfb, 0xdf, 0xfd, 0xbf, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x0b, 0xfe, 0x7f, 0xfc, 0x7f, 0xfb, 0xff, 0xfb, 0xdf, 0xfd, 0xbf,
+  0xfc, 0x3f, 0x89
 };
\ No newline at end of file
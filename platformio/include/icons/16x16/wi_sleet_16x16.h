@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_sleet_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0x9f, 0xef, 0xe7, 0xdf, 0xf7, 0xdf, 0xf7, 0xef, 0xe7, 0xf6, 0xef,
-  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x10, 0xfc, 0x7f, 0xfb, 0xbf, 0xf7, 0x9f, 0xef, 0xe7, 0xdf, 0xf7,
+  0xdf, 0xf7, 0xef, 0xe7, 0xf6, 0xef, 0xfb, 0x86
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_small_craft_advisory_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x3f,
-  0xf8, 0x3f, 0xf9, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff,
-  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x10, 0xf8, 0xff, 0xf8, 0x3f, 0xf8, 0x3f, 0xf9, 0xff, 0xfb, 0xff,
+  0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0x86
 };
\ No newline at end of file
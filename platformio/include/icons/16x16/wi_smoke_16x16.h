@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_smoke_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xfb, 0xbf, 0xf7, 0xef,
-  0xef, 0xff, 0xf7, 0xff, 0xf9, 0xef, 0xfe, 0x1f, 0xfe, 0x3f, 0xff, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x11, 0xfd, 0xbf, 0xfb, 0xbf, 0xf7, 0xef, 0xef, 0xff, 0xf7, 0xff,
+  0xf9, 0xef, 0xfe, 0x1f, 0xfe, 0x3f, 0xff, 0x7f, 0x87
 };
\ No newline at end of file
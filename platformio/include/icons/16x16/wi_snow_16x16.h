@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_snow_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xdf, 0xef, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xef, 0xf7, 0xf7, 0xef,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x09, 0xfc, 0x7f, 0xfb, 0xbf, 0xf7, 0xdf, 0xef, 0xf7, 0xff, 0xf7,
+  0x81, 0x03, 0xef, 0xf7, 0xf7, 0xef, 0x87
 };
\ No newline at end of file
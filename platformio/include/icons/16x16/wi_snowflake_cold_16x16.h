@@ -1,6 +1,4 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_snowflake_cold_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x3f, 0xf8, 0x1f, 0xfe, 0x7f, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8b, 0x07, 0xfc, 0x3f, 0xf8, 0x1f, 0xfe, 0x7f, 0xfd, 0xbf, 0x8b
 };
\ No newline at end of file
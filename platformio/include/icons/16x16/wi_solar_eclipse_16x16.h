@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_solar_eclipse_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xfc, 0x3f, 0xe8, 0x57, 0xf8, 0x5f, 0xfc, 0x3f, 0xfe, 0x7f, 0xf7, 0xef,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x0f, 0xf7, 0xef, 0xfe, 0x7f, 0xfc, 0x3f, 0xe8, 0x57, 0xf8, 0x5f,
+  0xfc, 0x3f, 0xfe, 0x7f, 0xf7, 0xef, 0x87
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_sprinkle_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xdf, 0xef, 0xf7, 0xff, 0xf7, 0xfd, 0xff, 0xef, 0x77, 0xf6, 0x2f,
-  0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x11, 0xfc, 0x7f, 0xfb, 0xbf, 0xf7, 0xdf, 0xef, 0xf7, 0xff, 0xf7,
+  0xfd, 0xff, 0xef, 0x77, 0xf6, 0x2f, 0xff, 0x7f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_stars_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfd, 0xff,
-  0xff, 0xff, 0xff, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x04, 0xfd, 0xff, 0xf8, 0xff, 0xfd, 0x83, 0x02, 0xef, 0xf7, 0xef,
+  0x81, 0x02, 0xfe, 0x7f, 0xfe, 0x88
 };
\ No newline at end of file
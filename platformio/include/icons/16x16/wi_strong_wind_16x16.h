@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_strong_wind_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-  0xff, 0xfb, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0x9f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8a, 0x04, 0xf3, 0xff, 0xfb, 0xc0, 0x03, 0x81, 0x03, 0xc0, 0x1f, 0xff,
+  0x9f, 0x89
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_sunrise_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf7, 0xef, 0xfc, 0x3f,
-  0xf9, 0x9f, 0xfb, 0xdf, 0xdb, 0xdb, 0xfa, 0x5f, 0xfc, 0x3f, 0xf9, 0x9f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x01, 0xfe, 0x7f, 0x81, 0x0f, 0xf7, 0xef, 0xfc, 0x3f, 0xf9, 0x9f,
+  0xfb, 0xdf, 0xdb, 0xdb, 0xfa, 0x5f, 0xfc, 0x3f, 0xf9, 0x9f, 0x87
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_thermometer_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0xbf, 0xfc, 0xbf,
+  0x81, 0x17, 0xfe, 0x7f, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0xbf, 0xfc, 0xbf,
   0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0xbf, 0xf8, 0x1f, 0xf8, 0x1f, 0xfc, 0x3f,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xfc, 0x3f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_thunderstorm_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xcf, 0xef, 0xf7, 0xef, 0xff, 0xf9, 0x5f, 0xe3, 0x77, 0xf2, 0xaf,
-  0xf2, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x12, 0xfc, 0x7f, 0xfb, 0xbf, 0xf7, 0xcf, 0xef, 0xf7, 0xef, 0xff,
+  0xf9, 0x5f, 0xe3, 0x77, 0xf2, 0xaf, 0xf2, 0xbf, 0xfa, 0x84
 };
\ No newline at end of file
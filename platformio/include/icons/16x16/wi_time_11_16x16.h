@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_time_11_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf3, 0xcf, 0xe7, 0xe7, 0xcc, 0xf3,
-  0xce, 0xf3, 0xde, 0xfb, 0xdf, 0xfb, 0xcf, 0xf3, 0xef, 0xf7, 0xe7, 0xe7,
-  0xf0, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf8, 0x1f, 0xf3, 0xcf, 0xe7, 0xe7, 0xcc, 0xf3, 0xce, 0xf3,
+  0xde, 0xfb, 0xdf, 0xfb, 0xcf, 0xf3, 0xef, 0xf7, 0xe7, 0xe7, 0xf0, 0x0f,
+  0xfe, 0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_tornado_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xef, 0xf3, 0xe7, 0xf3, 0xe8, 0x0f,
-  0xef, 0xcf, 0xe0, 0x3f, 0xcf, 0x3f, 0xe0, 0xff, 0xec, 0xff, 0xf1, 0xff,
-  0xe5, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x16, 0xf0, 0x07, 0xef, 0xf3, 0xe7, 0xf3, 0xe8, 0x0f, 0xef, 0xcf,
+  0xe0, 0x3f, 0xcf, 0x3f, 0xe0, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xe5, 0xff,
+  0xf3, 0x84
 };
\ No newline at end of file
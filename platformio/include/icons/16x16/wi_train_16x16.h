@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_train_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf,
-  0xe3, 0xbf, 0xeb, 0x9f, 0xf8, 0x0f, 0xe0, 0x0f, 0xe0, 0x0f, 0xe4, 0x07,
-  0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x84, 0x14, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xe3, 0xbf, 0xeb,
+  0x9f, 0xf8, 0x0f, 0xe0, 0x0f, 0xe0, 0x0f, 0xe4, 0x07, 0xff, 0xf7, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_tsunami_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xfb, 0xef, 0xf6, 0xcf, 0xed, 0xdf,
-  0xef, 0x3f, 0xed, 0xff, 0xed, 0x8f, 0xef, 0xb7, 0xeb, 0xbf, 0xe0, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x13, 0xfe, 0x0f, 0xfb, 0xef, 0xf6, 0xcf, 0xed, 0xdf, 0xef, 0x3f,
+  0xed, 0xff, 0xed, 0x8f, 0xef, 0xb7, 0xeb, 0xbf, 0xe0, 0x07, 0x87
 };
\ No newline at end of file
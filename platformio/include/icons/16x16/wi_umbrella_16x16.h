@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_umbrella_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfb, 0xdf, 0xf7, 0xef,
-  0xef, 0xf7, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-  0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x09, 0xfe, 0x7f, 0xfb, 0xdf, 0xf7, 0xef, 0xef, 0xf7, 0xe0, 0x07,
+  0x85, 0x02, 0xfb, 0xff, 0xfc, 0x86
 };
\ No newline at end of file
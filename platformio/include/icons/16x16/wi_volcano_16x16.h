@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_volcano_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x7f,
-  0xfe, 0xff, 0xff, 0x7f, 0xfe, 0x7f, 0xfc, 0xbf, 0xf8, 0x9f, 0xf0, 0x8f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x08, 0xfe, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x81,
+  0x08, 0x7f, 0xfe, 0x7f, 0xfc, 0xbf, 0xf8, 0x9f, 0xf0, 0x8f, 0x87
 };
\ No newline at end of file
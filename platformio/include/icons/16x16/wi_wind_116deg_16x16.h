@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_116deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xf3, 0x8f, 0xe7, 0xe7, 0xcf, 0xf7,
-  0xd9, 0xf3, 0xdc, 0x13, 0xde, 0x13, 0xdf, 0x33, 0xcf, 0xb7, 0xe7, 0xef,
-  0xf1, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf8, 0x3f, 0xf3, 0x8f, 0xe7, 0xe7, 0xcf, 0xf7, 0xd9, 0xf3,
+  0xdc, 0x13, 0xde, 0x13, 0xdf, 0x33, 0xcf, 0xb7, 0xe7, 0xef, 0xf1, 0x0f,
+  0xfc, 0x3f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_12deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x0f, 0xe7, 0xe7, 0xee, 0xf7,
-  0xce, 0x33, 0xde, 0x3b, 0xde, 0x7b, 0xde, 0x73, 0xce, 0xf7, 0xe7, 0xe7,
-  0xf3, 0xcf, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xfc, 0x7f, 0xf0, 0x0f, 0xe7, 0xe7, 0xee, 0xf7, 0xce, 0x33,
+  0xde, 0x3b, 0xde, 0x7b, 0xde, 0x73, 0xce, 0xf7, 0xe7, 0xe7, 0xf3, 0xcf,
+  0xf8, 0x1f, 0x83
 };
\ No newline at end of file
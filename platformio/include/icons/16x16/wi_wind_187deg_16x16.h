@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_187deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf3, 0xcf, 0xe7, 0x67, 0xcf, 0x73,
-  0xce, 0x7b, 0xde, 0x7b, 0xdc, 0x7b, 0xcc, 0x73, 0xed, 0x37, 0xe7, 0xe7,
-  0xf0, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf8, 0x1f, 0xf3, 0xcf, 0xe7, 0x67, 0xcf, 0x73, 0xce, 0x7b,
+  0xde, 0x7b, 0xdc, 0x7b, 0xcc, 0x73, 0xed, 0x37, 0xe7, 0xe7, 0xf0, 0x0f,
+  0xfc, 0x3f, 0x83
 };
\ No newline at end of file
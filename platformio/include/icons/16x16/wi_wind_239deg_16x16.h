@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_239deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xf1, 0xcf, 0xe7, 0xe7, 0xef, 0xf3,
-  0xcf, 0x9b, 0xc8, 0x3b, 0xc8, 0x7b, 0xcc, 0xfb, 0xed, 0xf3, 0xf7, 0xe7,
-  0xf0, 0x8f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xfc, 0x1f, 0xf1, 0xcf, 0xe7, 0xe7, 0xef, 0xf3, 0xcf, 0x9b,
+  0xc8, 0x3b, 0xc8, 0x7b, 0xcc, 0xfb, 0xed, 0xf3, 0xf7, 0xe7, 0xf0, 0x8f,
+  0xfc, 0x3f, 0x83
 };
\ No newline at end of file
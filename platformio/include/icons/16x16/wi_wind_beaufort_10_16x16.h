@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_10_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-  0xc1, 0xff, 0xc0, 0xff, 0xfe, 0xa3, 0xff, 0xab, 0xff, 0xab, 0xff, 0xb7,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8a, 0x0c, 0xbf, 0xc1, 0xff, 0xc0, 0xff, 0xfe, 0xa3, 0xff, 0xab, 0xff,
+  0xab, 0xff, 0xb7, 0x87
 };
\ No newline at end of file
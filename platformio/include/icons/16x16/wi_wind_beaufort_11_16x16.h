@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_11_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-  0xe0, 0xff, 0xe0, 0x7f, 0xff, 0x57, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0xdf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8a, 0x0c, 0xdf, 0xe0, 0xff, 0xe0, 0x7f, 0xff, 0x57, 0xff, 0xd7, 0xff,
+  0xd7, 0xff, 0xdf, 0x87
 };
\ No newline at end of file
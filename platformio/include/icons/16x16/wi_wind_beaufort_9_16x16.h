@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_9_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-  0xe0, 0x7f, 0xe0, 0x7f, 0xff, 0x47, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xcf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8a, 0x0c, 0xdf, 0xe0, 0x7f, 0xe0, 0x7f, 0xff, 0x47, 0xff, 0xc7, 0xff,
+  0xc7, 0xff, 0xcf, 0x87
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wifi_3_bar_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x1f, 0xe7, 0xc7, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8b, 0x03, 0xf8, 0x1f, 0xe7, 0xc7, 0x81, 0x03, 0xfc, 0x3f, 0xfb, 0xdf,
+  0x81, 0x01, 0xfe, 0x7f, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wifi_off_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xe4, 0x1f, 0xe7, 0xe7, 0x9b, 0xf9,
-  0xf9, 0x9f, 0xe2, 0xcf, 0xff, 0x7f, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xef,
-  0xfe, 0x67, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xef, 0xff, 0xe4, 0x1f, 0xe7, 0xe7, 0x9b, 0xf9, 0xf9, 0x9f,
+  0xe2, 0xcf, 0xff, 0x7f, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xef, 0xfe, 0x67,
+  0xff, 0xf7, 0x83
 };
\ No newline at end of file
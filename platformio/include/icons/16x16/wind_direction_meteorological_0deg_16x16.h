@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_0deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xf1, 0xcf, 0xf0, 0x0f, 0xf8, 0x1f,
-  0xf8, 0x1f, 0xf8, 0x1f, 0xfc, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x3f,
-  0xfe, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x17, 0xf7, 0xef, 0xf1, 0xcf, 0xf0, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f,
+  0xf8, 0x1f, 0xfc, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x3f, 0xfe, 0x7f,
+  0xff, 0x7f, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_100deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81,
-  0xe0, 0x03, 0xc0, 0x07, 0xf0, 0x0f, 0xf8, 0x0f, 0xfe, 0x0f, 0xff, 0x87,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x8a, 0x0e, 0x81, 0xe0, 0x03, 0xc0, 0x07, 0xf0, 0x0f, 0xf8, 0x0f, 0xfe,
+  0x0f, 0xff, 0x87, 0xff, 0xe7, 0x85
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_104deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81,
-  0xc0, 0x03, 0xc0, 0x07, 0xf0, 0x0f, 0xfc, 0x0f, 0xfe, 0x0f, 0xff, 0x8f,
-  0xff, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff
+  0x8a, 0x10, 0x81, 0xc0, 0x03, 0xc0, 0x07, 0xf0, 0x0f, 0xfc, 0x0f, 0xfe,
+  0x0f, 0xff, 0x8f, 0xff, 0xc7, 0xff, 0xf7, 0x83
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_120deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff,
-  0xe0, 0x07, 0xf0, 0x00, 0xf8, 0x03, 0xfc, 0x0f, 0xfe, 0x1f, 0xff, 0x1f,
-  0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff
+  0x89, 0x13, 0xc1, 0xff, 0xe0, 0x07, 0xf0, 0x00, 0xf8, 0x03, 0xfc, 0x0f,
+  0xfe, 0x1f, 0xff, 0x1f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0x81
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_123deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-  0xf0, 0x0f, 0xf0, 0x01, 0xf8, 0x01, 0xfc, 0x0f, 0xfe, 0x1f, 0xff, 0x1f,
-  0xff, 0x1f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xff
+  0x89, 0x13, 0xe0, 0xff, 0xf0, 0x0f, 0xf0, 0x01, 0xf8, 0x01, 0xfc, 0x0f,
+  0xfe, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x9f, 0xff, 0xdf, 0x81
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_134deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xf0, 0xff,
-  0xf0, 0x3f, 0xf8, 0x07, 0xf8, 0x01, 0xfc, 0x01, 0xfc, 0x1f, 0xfe, 0x3f,
-  0xff, 0x3f, 0xff, 0x3f, 0xff, 0xbf, 0xff, 0xff
+  0x87, 0x15, 0xe3, 0xff, 0xf0, 0xff, 0xf0, 0x3f, 0xf8, 0x07, 0xf8, 0x01,
+  0xfc, 0x01, 0xfc, 0x1f, 0xfe, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0xbf,
+  0x81
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_141deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf1, 0xff, 0xf0, 0xff,
-  0xf8, 0x3f, 0xf8, 0x0f, 0xf8, 0x07, 0xfc, 0x01, 0xfc, 0x01, 0xfe, 0x3f,
-  0xfe, 0x3f, 0xfe, 0x7f, 0xff, 0x7f, 0xff, 0xff
+  0x85, 0x17, 0xf7, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf8, 0x3f, 0xf8, 0x0f,
+  0xf8, 0x07, 0xfc, 0x01, 0xfc, 0x01, 0xfe, 0x3f, 0xfe, 0x3f, 0xfe, 0x7f,
+  0xff, 0x7f, 0x81
 };
\ No newline at end of file
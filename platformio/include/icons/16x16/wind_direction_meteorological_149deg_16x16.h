@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_149deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0xf8, 0x7f,
-  0xf8, 0x3f, 0xf8, 0x1f, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x01, 0xfc, 0x7f,
-  0xfc, 0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff
+  0x85, 0x16, 0xf3, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xf8, 0x3f, 0xf8, 0x1f,
+  0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x01, 0xfc, 0x7f, 0xfc, 0x7f, 0xfe, 0x7f,
+  0xfe, 0x82
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_157deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0x7f,
-  0xf8, 0x3f, 0xf8, 0x1f, 0xf8, 0x0f, 0xfc, 0x07, 0xfc, 0x07, 0xfc, 0x43,
-  0xfc, 0x7f, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff
+  0x83, 0x18, 0xfb, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xf8, 0x3f,
+  0xf8, 0x1f, 0xf8, 0x0f, 0xfc, 0x07, 0xfc, 0x07, 0xfc, 0x43, 0xfc, 0x7f,
+  0xfc, 0xff, 0xfd, 0x82
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_18deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xfc, 0xfb, 0xfc, 0x43, 0xfc, 0x07,
+  0x81, 0x18, 0xf9, 0xff, 0xf8, 0xff, 0xfc, 0xfb, 0xfc, 0x43, 0xfc, 0x07,
   0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x1f, 0xfc, 0x3f, 0xfc, 0x7f, 0xfc, 0x7f,
-  0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xfc, 0xff, 0xfd, 0x84
 };
\ No newline at end of file
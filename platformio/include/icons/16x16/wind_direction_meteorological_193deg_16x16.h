@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_193deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x3f, 0xfe, 0x3f, 0xfe, 0x3f,
-  0xfc, 0x3f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf0, 0x1f, 0xf0, 0x1f, 0xe0, 0x1f,
-  0xc7, 0x1f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xff
+  0x84, 0x18, 0x3f, 0xff, 0x3f, 0xfe, 0x3f, 0xfe, 0x3f, 0xfc, 0x3f, 0xf8,
+  0x3f, 0xf8, 0x3f, 0xf0, 0x1f, 0xf0, 0x1f, 0xe0, 0x1f, 0xc7, 0x1f, 0xff,
+  0x9f, 0xff, 0xdf, 0x81
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_213_75deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x1f, 0xfe, 0x1f,
-  0xfc, 0x1f, 0xf8, 0x1f, 0xe0, 0x3f, 0xc0, 0x3f, 0x80, 0x3f, 0xfc, 0x3f,
-  0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff
+  0x86, 0x16, 0xcf, 0xff, 0x1f, 0xfe, 0x1f, 0xfc, 0x1f, 0xf8, 0x1f, 0xe0,
+  0x3f, 0xc0, 0x3f, 0x80, 0x3f, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe,
+  0x7f, 0x81
 };
\ No newline at end of file
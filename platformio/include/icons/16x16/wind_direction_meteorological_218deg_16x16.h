@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_218deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x8f, 0xfe, 0x1f,
-  0xfc, 0x1f, 0xf0, 0x1f, 0xe0, 0x3f, 0x80, 0x3f, 0x80, 0x3f, 0xfc, 0x7f,
-  0xfc, 0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xfe, 0xff
+  0x86, 0x18, 0xcf, 0xff, 0x8f, 0xfe, 0x1f, 0xfc, 0x1f, 0xf0, 0x1f, 0xe0,
+  0x3f, 0x80, 0x3f, 0x80, 0x3f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfe, 0x7f, 0xfe,
+  0xff, 0xfe, 0xff
 };
\ No newline at end of file
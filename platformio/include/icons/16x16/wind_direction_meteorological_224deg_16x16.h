@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_224deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x8f, 0xfe, 0x0f,
-  0xf8, 0x1f, 0xf0, 0x1f, 0xc0, 0x3f, 0x80, 0x3f, 0xf8, 0x7f, 0xfc, 0x7f,
-  0xfc, 0x7f, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff
+  0x86, 0x15, 0xef, 0xff, 0x8f, 0xfe, 0x0f, 0xf8, 0x1f, 0xf0, 0x1f, 0xc0,
+  0x3f, 0x80, 0x3f, 0xf8, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0xff, 0xfc,
+  0x82
 };
\ No newline at end of file
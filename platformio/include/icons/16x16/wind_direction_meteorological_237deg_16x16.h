@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_237deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x07,
-  0xf0, 0x0f, 0x80, 0x1f, 0x80, 0x1f, 0xf0, 0x3f, 0xf8, 0x7f, 0xf8, 0xff,
-  0xf8, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff
+  0x88, 0x13, 0xe7, 0xff, 0x07, 0xf0, 0x0f, 0x80, 0x1f, 0x80, 0x1f, 0xf0,
+  0x3f, 0xf8, 0x7f, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfb, 0x82
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_257deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f,
-  0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x3f, 0xf0, 0xff, 0xe1, 0xff,
-  0xe7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x89, 0x10, 0x80, 0x7f, 0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x3f,
+  0xf0, 0xff, 0xe1, 0xff, 0xe7, 0xff, 0xef, 0x84
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_263deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x7f,
-  0xe0, 0x03, 0xf0, 0x03, 0xf0, 0x0f, 0xf0, 0x3f, 0xe0, 0xff, 0xe3, 0xff,
-  0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x10, 0x9f, 0xff, 0xc0, 0x7f, 0xe0, 0x03, 0xf0, 0x03, 0xf0, 0x0f,
+  0xf0, 0x3f, 0xe0, 0xff, 0xe3, 0xff, 0xcf, 0x86
 };
\ No newline at end of file
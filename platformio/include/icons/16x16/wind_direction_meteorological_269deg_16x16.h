@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_269deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xe0, 0x7f,
-  0xe0, 0x0f, 0xf0, 0x03, 0xf0, 0x07, 0xe0, 0x1f, 0xe0, 0xff, 0xc7, 0xff,
-  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87, 0x10, 0xc7, 0xff, 0xe0, 0x7f, 0xe0, 0x0f, 0xf0, 0x03, 0xf0, 0x07,
+  0xe0, 0x1f, 0xe0, 0xff, 0xc7, 0xff, 0xdf, 0x86
 };
\ No newline at end of file
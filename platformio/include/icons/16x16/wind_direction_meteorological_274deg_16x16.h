@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_274deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xc3, 0xff, 0xe0, 0x7f,
-  0xf0, 0x1f, 0xf0, 0x03, 0xf0, 0x03, 0xe0, 0x1f, 0xc0, 0xff, 0x8f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x10, 0xcf, 0xff, 0xc3, 0xff, 0xe0, 0x7f, 0xf0, 0x1f, 0xf0, 0x03,
+  0xf0, 0x03, 0xe0, 0x1f, 0xc0, 0xff, 0x8f, 0x88
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_281deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xe1, 0xff, 0xf0, 0x7f,
-  0xf0, 0x1f, 0xf0, 0x0f, 0xe0, 0x03, 0xc0, 0x03, 0x81, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x85, 0x0e, 0xe7, 0xff, 0xe1, 0xff, 0xf0, 0x7f, 0xf0, 0x1f, 0xf0, 0x0f,
+  0xe0, 0x03, 0xc0, 0x03, 0x81, 0x8a
 };
\ No newline at end of file
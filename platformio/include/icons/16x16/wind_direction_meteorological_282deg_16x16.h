@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_282deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xe1, 0xff, 0xf0, 0x7f,
-  0xf0, 0x3f, 0xf0, 0x0f, 0xe0, 0x03, 0xc0, 0x03, 0x81, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x10, 0xef, 0xff, 0xe7, 0xff, 0xe1, 0xff, 0xf0, 0x7f, 0xf0, 0x3f,
+  0xf0, 0x0f, 0xe0, 0x03, 0xc0, 0x03, 0x81, 0x8a
 };
\ No newline at end of file
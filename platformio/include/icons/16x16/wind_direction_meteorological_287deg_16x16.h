@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_287deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xe3, 0xff, 0xf1, 0xff, 0xf0, 0x7f,
-  0xf8, 0x3f, 0xf0, 0x0f, 0xe0, 0x07, 0x80, 0x03, 0x87, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x10, 0xe7, 0xff, 0xe3, 0xff, 0xf1, 0xff, 0xf0, 0x7f, 0xf8, 0x3f,
+  0xf0, 0x0f, 0xe0, 0x07, 0x80, 0x03, 0x87, 0x8a
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_289deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xf0, 0x7f,
-  0xf8, 0x3f, 0xf0, 0x0f, 0xc0, 0x07, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x0f, 0xe7, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xf0, 0x7f, 0xf8, 0x3f,
+  0xf0, 0x0f, 0xc0, 0x07, 0x80, 0x03, 0x8b
 };
\ No newline at end of file
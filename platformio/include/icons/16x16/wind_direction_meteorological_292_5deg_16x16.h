@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_292_5deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf8, 0x7f,
-  0xf8, 0x3f, 0xe0, 0x1f, 0xc0, 0x07, 0x80, 0x03, 0xff, 0xe3, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x83, 0x11, 0xf7, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf8, 0x7f, 0xf8, 0x3f,
+  0xe0, 0x1f, 0xc0, 0x07, 0x80, 0x03, 0xff, 0xe3, 0x89
 };
\ No newline at end of file
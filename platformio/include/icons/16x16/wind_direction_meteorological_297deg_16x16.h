@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_297deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xf8, 0xff, 0xf8, 0x7f,
-  0xf0, 0x3f, 0xe0, 0x1f, 0x80, 0x0f, 0x80, 0x07, 0xff, 0x83, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x81, 0x13, 0xf7, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xf8, 0xff, 0xf8, 0x7f,
+  0xf0, 0x3f, 0xe0, 0x1f, 0x80, 0x0f, 0x80, 0x07, 0xff, 0x83, 0x89
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_307deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xf8, 0x7f,
+  0x81, 0x15, 0xf9, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xf8, 0x7f,
   0xe0, 0x3f, 0x80, 0x1f, 0xc0, 0x1f, 0xf8, 0x0f, 0xff, 0x07, 0xff, 0xe7,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x87
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_323deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfe, 0xff, 0xfe, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0x80, 0x3f,
+  0x81, 0x17, 0xfe, 0xff, 0xfe, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0x80, 0x3f,
   0x80, 0x3f, 0xe0, 0x1f, 0xf8, 0x1f, 0xfc, 0x1f, 0xff, 0x0f, 0xff, 0x8f,
-  0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xff, 0xef, 0x85
 };
\ No newline at end of file
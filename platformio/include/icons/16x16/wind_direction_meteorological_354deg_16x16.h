@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_354deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xef, 0xef, 0xcf, 0xe3, 0x8f, 0xf0, 0x1f, 0xf0, 0x1f,
-  0xf8, 0x1f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x3f, 0xfe, 0x3f,
-  0xff, 0x3f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x18, 0xef, 0xef, 0xcf, 0xe3, 0x8f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf8,
+  0x1f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x3f, 0xfe, 0x3f, 0xff,
+  0x3f, 0xff, 0x7f, 0x83
 };
\ No newline at end of file
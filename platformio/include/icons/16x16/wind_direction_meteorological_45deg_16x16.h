@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_45deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xfe, 0x3f, 0xfe, 0x1f,
-  0xfc, 0x01, 0xfc, 0x01, 0xf8, 0x07, 0xf8, 0x1f, 0xf0, 0x7f, 0xf1, 0xff,
-  0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x15, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xfe, 0x3f, 0xfe, 0x1f, 0xfc,
+  0x01, 0xfc, 0x01, 0xf8, 0x07, 0xf8, 0x1f, 0xf0, 0x7f, 0xf1, 0xff, 0xf7,
+  0x86
 };
\ No newline at end of file
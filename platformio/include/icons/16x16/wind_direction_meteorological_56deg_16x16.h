@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_56deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x1f, 0xff, 0x1f, 0xfe, 0x1f,
-  0xfc, 0x0f, 0xf8, 0x01, 0xf8, 0x01, 0xf0, 0x0f, 0xe0, 0x7f, 0xe7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x13, 0xdf, 0xff, 0x9f, 0xff, 0x1f, 0xff, 0x1f, 0xfe, 0x1f, 0xfc,
+  0x0f, 0xf8, 0x01, 0xf8, 0x01, 0xf0, 0x0f, 0xe0, 0x7f, 0xe7, 0x88
 };
\ No newline at end of file
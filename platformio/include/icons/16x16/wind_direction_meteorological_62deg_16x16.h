@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_62deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xef, 0xff, 0xcf, 0xff, 0x8f, 0xff, 0x1f, 0xfe, 0x1f,
-  0xfc, 0x1f, 0xf8, 0x07, 0xf0, 0x01, 0xf0, 0x03, 0xe0, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x82, 0x12, 0xef, 0xff, 0xcf, 0xff, 0x8f, 0xff, 0x1f, 0xfe, 0x1f, 0xfc,
+  0x1f, 0xf8, 0x07, 0xf0, 0x01, 0xf0, 0x03, 0xe0, 0x7f, 0x89
 };
\ No newline at end of file
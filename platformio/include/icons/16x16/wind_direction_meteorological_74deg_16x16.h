@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_74deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xc7, 0xff, 0x8f, 0xff, 0x0f,
-  0xfc, 0x0f, 0xf8, 0x0f, 0xe0, 0x07, 0xc0, 0x01, 0xfc, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x84, 0x10, 0xf7, 0xff, 0xc7, 0xff, 0x8f, 0xff, 0x0f, 0xfc, 0x0f, 0xf8,
+  0x0f, 0xe0, 0x07, 0xc0, 0x01, 0xfc, 0x01, 0x89
 };
\ No newline at end of file
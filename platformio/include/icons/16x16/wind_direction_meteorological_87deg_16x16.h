@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_87deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xc3, 0xff, 0x07,
-  0xfc, 0x0f, 0xe0, 0x0f, 0xc0, 0x0f, 0xf0, 0x07, 0xff, 0x03, 0xff, 0xe3,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x86, 0x10, 0xfb, 0xff, 0xc3, 0xff, 0x07, 0xfc, 0x0f, 0xe0, 0x0f, 0xc0,
+  0x0f, 0xf0, 0x07, 0xff, 0x03, 0xff, 0xe3, 0x87
 };
\ No newline at end of file
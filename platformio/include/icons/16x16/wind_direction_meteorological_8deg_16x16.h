@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_8deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xf7, 0xff, 0xf3, 0xf7, 0xf8, 0xe7, 0xf8, 0x07, 0xf8, 0x0f,
+  0x81, 0x18, 0xf7, 0xff, 0xf3, 0xf7, 0xf8, 0xe7, 0xf8, 0x07, 0xf8, 0x0f,
   0xf8, 0x0f, 0xfc, 0x1f, 0xfc, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x7f,
-  0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff
+  0xfe, 0x7f, 0xfe, 0x84
 };
\ No newline at end of file
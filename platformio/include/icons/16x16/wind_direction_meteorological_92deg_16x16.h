@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wind_direction_meteorological_92deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x03,
-  0xf8, 0x07, 0xc0, 0x0f, 0xc0, 0x0f, 0xf8, 0x0f, 0xff, 0x07, 0xff, 0xc3,
-  0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x88, 0x10, 0xe3, 0xff, 0x03, 0xf8, 0x07, 0xc0, 0x0f, 0xc0, 0x0f, 0xf8,
+  0x0f, 0xff, 0x07, 0xff, 0xc3, 0xff, 0xfb, 0x85
 };
\ No newline at end of file
@@ -1,412 +1,157 @@
-// 196 x 196
+// 196 x 196, run-length encoded
 const unsigned char house_humidity_196x196[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x60, 0x00, 0x7f, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0xf0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x03, 0xfc, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xfe, 0x00, 0x07, 0xff, 0x80, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x03, 0xff, 0x80,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0x80, 0x01, 0xff,
-  0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xc0, 0x00,
-  0xff, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xe0,
-  0x00, 0x7f, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff,
-  0xf0, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03,
-  0xff, 0xff, 0xfc, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x07, 0xff, 0xff, 0xfe, 0x00, 0x07, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x03, 0x80, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0x9f,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0x0f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xfe, 0x03, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x3e, 0x03,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf8, 0x06, 0x00, 0x00, 0x7e,
-  0x01, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xc0, 0x00,
-  0x7c, 0x00, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0,
-  0x00, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xe0, 0xff,
-  0xf0, 0x00, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xe1,
-  0xff, 0xf8, 0x01, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xc3, 0xff, 0xf8, 0x01, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0x18, 0x01, 0xff, 0xff,
-  0xff, 0x83, 0xf0, 0xfc, 0x01, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x01,
-  0x80, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x38, 0x01, 0xff,
-  0xff, 0xff, 0x83, 0xf0, 0xfc, 0x03, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xf8,
-  0x01, 0xc0, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x78, 0x01,
-  0xff, 0xff, 0xff, 0x03, 0xf0, 0xfc, 0x03, 0xe0, 0x00, 0x1f, 0xff, 0xff,
-  0xf8, 0x01, 0xe0, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xfc, 0x07, 0xe0, 0x00, 0x0f, 0xff,
-  0xff, 0xf8, 0x01, 0xf0, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x01,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xfc, 0x07, 0xc0, 0x00, 0x0f,
-  0xff, 0xff, 0xf8, 0x01, 0xf8, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe,
-  0x03, 0xf8, 0x01, 0xff, 0xff, 0xfe, 0x03, 0xf0, 0xfc, 0x0f, 0xc0, 0x00,
-  0x07, 0xff, 0xff, 0xf8, 0x01, 0xfc, 0x07, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0x07, 0xf8, 0x01, 0xff, 0xff, 0xfe, 0x03, 0xf0, 0xfc, 0x0f, 0x80,
-  0x00, 0x07, 0xff, 0xff, 0xf8, 0x01, 0xfe, 0x0f, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xfc, 0x03, 0xf0, 0xfc, 0x1f,
-  0x80, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xfc, 0x03, 0xf0, 0xfc,
-  0x1f, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xfc, 0x03, 0xf0,
-  0xfc, 0x3f, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x03,
-  0xf9, 0xfc, 0x3e, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xf8, 0x7e, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xf8, 0x7c, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xf8, 0x00, 0xff, 0xf0, 0x7c, 0x03, 0x80, 0x01, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xf8, 0x00, 0x7f, 0xe0, 0xf8, 0x1f, 0xf0, 0x01, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0x80, 0xf8, 0x3f, 0xf8, 0x01, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xf0, 0x7f, 0xfc, 0x01,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xf0, 0x7f, 0xfe,
-  0x01, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xf0, 0xfe,
-  0xfe, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xe0,
-  0xfc, 0x7f, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x07,
-  0xe0, 0xfc, 0x3f, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x07, 0xc1, 0xfc, 0x3f, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x0f, 0xc1, 0xf8, 0x3f, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x0f, 0x81, 0xf8, 0x3f, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x1f, 0x81, 0xf8, 0x3f, 0x03, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x1f, 0x01, 0xf8, 0x3f, 0x03, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0x01, 0xfc, 0x3f, 0x03, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3e, 0x00, 0xfc, 0x3f, 0x07, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3e, 0x00, 0xfc, 0x3f, 0x07,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7c, 0x00, 0xfc, 0x7e,
-  0x07, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7c, 0x00, 0xff,
-  0xfe, 0x0f, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf8, 0x00,
-  0x7f, 0xfc, 0x0f, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0x80, 0x00, 0xf8,
-  0x00, 0x3f, 0xfc, 0x1f, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x01,
-  0xf8, 0x00, 0x1f, 0xf8, 0x3f, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xc0,
-  0x01, 0xf0, 0x00, 0x0f, 0xe0, 0x3f, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff,
-  0xe0, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0
+  0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x86,
+  0x01, 0xfc, 0x03, 0x96, 0x01, 0xf0, 0x00, 0x96, 0x02, 0xe0, 0x00, 0x7f,
+  0x95, 0x02, 0xc0, 0x00, 0x3f, 0x95, 0x02, 0x80, 0x00, 0x1f, 0x95, 0xc1,
+  0x00, 0x0f, 0x94, 0x00, 0xfe, 0xc1, 0x00, 0x07, 0x94, 0x00, 0xfc, 0xc1,
+  0x00, 0x03, 0x94, 0x00, 0xf8, 0xc1, 0x00, 0x01, 0x81, 0x02, 0xe0, 0x00,
+  0x1f, 0x8f, 0x00, 0xf0, 0xc2, 0x81, 0x02, 0xc0, 0x00, 0x0f, 0x8f, 0x08,
+  0xe0, 0x00, 0x60, 0x00, 0x7f, 0xff, 0x80, 0x00, 0x0f, 0x8f, 0x08, 0xc0,
+  0x00, 0xf0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x07, 0x8f, 0x08, 0x80, 0x01,
+  0xf8, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x07, 0x8f, 0xc0, 0x07, 0x03, 0xfc,
+  0x00, 0x0f, 0xff, 0x80, 0x00, 0x07, 0x8e, 0x09, 0xfe, 0x00, 0x07, 0xfe,
+  0x00, 0x07, 0xff, 0x80, 0x00, 0x07, 0x8e, 0x09, 0xfc, 0x00, 0x0f, 0xff,
+  0x00, 0x03, 0xff, 0x80, 0x00, 0x07, 0x8e, 0x09, 0xf8, 0x00, 0x1f, 0xff,
+  0x80, 0x01, 0xff, 0x80, 0x00, 0x07, 0x8e, 0x09, 0xf0, 0x00, 0x3f, 0xff,
+  0xc0, 0x00, 0xff, 0x80, 0x00, 0x07, 0x8e, 0x09, 0xe0, 0x00, 0x7f, 0xff,
+  0xe0, 0x00, 0x7f, 0x80, 0x00, 0x07, 0x8e, 0x01, 0xc0, 0x00, 0x81, 0x05,
+  0xf0, 0x00, 0x3f, 0x80, 0x00, 0x07, 0x8e, 0x01, 0x80, 0x01, 0x81, 0x05,
+  0xf8, 0x00, 0x1f, 0x80, 0x00, 0x07, 0x8e, 0xc0, 0x00, 0x03, 0x81, 0x05,
+  0xfc, 0x00, 0x0f, 0x80, 0x00, 0x07, 0x8d, 0x02, 0xfe, 0x00, 0x07, 0x81,
+  0x05, 0xfe, 0x00, 0x07, 0x80, 0x00, 0x07, 0x8d, 0x02, 0xfc, 0x00, 0x0f,
+  0x82, 0xc0, 0x03, 0x03, 0x80, 0x00, 0x07, 0x8d, 0x02, 0xf8, 0x00, 0x1f,
+  0x82, 0x04, 0x80, 0x01, 0x80, 0x00, 0x07, 0x8d, 0x02, 0xf0, 0x00, 0x3f,
+  0x82, 0x00, 0xc0, 0xc2, 0x00, 0x07, 0x8d, 0x02, 0xe0, 0x00, 0x7f, 0x82,
+  0x00, 0xe0, 0xc2, 0x00, 0x07, 0x8d, 0x01, 0xc0, 0x00, 0x83, 0x00, 0xf0,
+  0xc2, 0x00, 0x07, 0x8d, 0x01, 0x80, 0x01, 0x83, 0x00, 0xf8, 0xc2, 0x00,
+  0x07, 0x8d, 0xc0, 0x00, 0x03, 0x83, 0x00, 0xfc, 0xc2, 0x00, 0x07, 0x8c,
+  0x02, 0xfe, 0x00, 0x07, 0x83, 0x00, 0xfe, 0xc2, 0x00, 0x07, 0x8c, 0x02,
+  0xfc, 0x00, 0x0f, 0x84, 0xc2, 0x00, 0x07, 0x8c, 0x02, 0xf8, 0x00, 0x1f,
+  0x84, 0x00, 0x80, 0xc1, 0x00, 0x07, 0x8c, 0x02, 0xf0, 0x00, 0x3f, 0x84,
+  0x00, 0xc0, 0xc1, 0x00, 0x07, 0x8c, 0x02, 0xe0, 0x00, 0x7f, 0x84, 0x00,
+  0xe0, 0xc1, 0x00, 0x07, 0x8c, 0x01, 0xc0, 0x00, 0x85, 0x00, 0xf0, 0xc1,
+  0x00, 0x07, 0x8c, 0x01, 0x80, 0x01, 0x85, 0x00, 0xf8, 0xc1, 0x00, 0x07,
+  0x8c, 0xc0, 0x00, 0x03, 0x85, 0x00, 0xfc, 0xc1, 0x00, 0x07, 0x8b, 0x02,
+  0xfe, 0x00, 0x07, 0x85, 0x00, 0xfe, 0xc1, 0x00, 0x07, 0x8b, 0x02, 0xfc,
+  0x00, 0x0f, 0x86, 0xc1, 0x00, 0x07, 0x8b, 0x02, 0xf8, 0x00, 0x1f, 0x86,
+  0x02, 0x80, 0x00, 0x07, 0x8b, 0x02, 0xf0, 0x00, 0x3f, 0x86, 0x02, 0xc0,
+  0x00, 0x07, 0x8b, 0x02, 0xe0, 0x00, 0x7f, 0x86, 0x02, 0xe0, 0x00, 0x07,
+  0x8b, 0x01, 0xc0, 0x00, 0x83, 0x00, 0x9f, 0x82, 0x02, 0xf0, 0x00, 0x07,
+  0x8b, 0x01, 0x80, 0x01, 0x83, 0x00, 0x0f, 0x82, 0x02, 0xf8, 0x00, 0x07,
+  0x8b, 0xc0, 0x00, 0x03, 0x82, 0x01, 0xfe, 0x03, 0x82, 0x02, 0xfc, 0x00,
+  0x07, 0x8a, 0x02, 0xfe, 0x00, 0x07, 0x82, 0x01, 0xfc, 0x03, 0x82, 0x02,
+  0xfe, 0x00, 0x07, 0x8a, 0x02, 0xfc, 0x00, 0x0f, 0x82, 0x01, 0xf8, 0x01,
+  0x83, 0xc0, 0x00, 0x03, 0x8a, 0x02, 0xf8, 0x00, 0x1f, 0x82, 0x01, 0xf0,
+  0x00, 0x83, 0x01, 0x80, 0x01, 0x8a, 0x02, 0xf0, 0x00, 0x3f, 0x82, 0x02,
+  0xe0, 0x00, 0x7f, 0x82, 0x01, 0xc0, 0x00, 0x8a, 0x02, 0xe0, 0x00, 0x7f,
+  0x82, 0x02, 0xc0, 0x00, 0x3f, 0x82, 0x02, 0xe0, 0x00, 0x7f, 0x89, 0x01,
+  0xc0, 0x00, 0x83, 0x02, 0x80, 0x00, 0x1f, 0x82, 0x02, 0xf0, 0x00, 0x3f,
+  0x89, 0x01, 0x80, 0x01, 0x83, 0xc1, 0x00, 0x0f, 0x82, 0x02, 0xf8, 0x00,
+  0x1f, 0x89, 0xc0, 0x00, 0x03, 0x82, 0x00, 0xfe, 0xc1, 0x00, 0x07, 0x82,
+  0x02, 0xfc, 0x00, 0x0f, 0x88, 0x02, 0xfe, 0x00, 0x07, 0x82, 0x00, 0xfc,
+  0xc1, 0x00, 0x03, 0x82, 0x02, 0xfe, 0x00, 0x07, 0x88, 0x02, 0xfc, 0x00,
+  0x0f, 0x82, 0x00, 0xf8, 0xc1, 0x00, 0x03, 0x83, 0xc0, 0x00, 0x03, 0x88,
+  0x02, 0xf8, 0x00, 0x1f, 0x82, 0x00, 0xf8, 0xc1, 0x00, 0x01, 0x83, 0x01,
+  0x80, 0x01, 0x88, 0x02, 0xf0, 0x00, 0x3f, 0x82, 0x00, 0xf0, 0xc2, 0x83,
+  0x01, 0xc0, 0x00, 0x88, 0x02, 0xe0, 0x00, 0x7f, 0x82, 0x00, 0xe0, 0xc2,
+  0x00, 0x7f, 0x82, 0x02, 0xe0, 0x00, 0x7f, 0x87, 0x01, 0xc0, 0x00, 0x83,
+  0x00, 0xc0, 0xc2, 0x00, 0x3f, 0x82, 0x02, 0xf0, 0x00, 0x3f, 0x87, 0x01,
+  0x80, 0x01, 0x83, 0x00, 0x80, 0xc2, 0x00, 0x1f, 0x82, 0x02, 0xf8, 0x00,
+  0x1f, 0x87, 0xc0, 0x00, 0x01, 0x83, 0x00, 0x80, 0xc2, 0x00, 0x1f, 0x82,
+  0x02, 0xf8, 0x00, 0x0f, 0x86, 0x02, 0xfe, 0x00, 0x01, 0x83, 0xc3, 0x00,
+  0x0f, 0x82, 0x02, 0xf8, 0x00, 0x07, 0x86, 0x02, 0xfc, 0x00, 0x01, 0x82,
+  0x00, 0xfe, 0xc3, 0x00, 0x07, 0x82, 0x02, 0xf8, 0x00, 0x03, 0x86, 0x02,
+  0xf8, 0x00, 0x01, 0x82, 0x00, 0xfc, 0xc3, 0x00, 0x03, 0x82, 0x02, 0xf8,
+  0x00, 0x01, 0x86, 0x02, 0xf0, 0x00, 0x01, 0x82, 0x00, 0xfc, 0xc2, 0x01,
+  0x3e, 0x03, 0x82, 0x00, 0xf8, 0xc1, 0x86, 0x02, 0xe0, 0x00, 0x01, 0x82,
+  0x01, 0xf8, 0x06, 0xc1, 0x01, 0x7e, 0x01, 0x82, 0x00, 0xf8, 0xc1, 0x00,
+  0x7f, 0x85, 0x02, 0xc0, 0x00, 0x01, 0x82, 0x05, 0xf0, 0x3f, 0xc0, 0x00,
+  0x7c, 0x00, 0x82, 0x00, 0xf8, 0xc1, 0x00, 0x3f, 0x85, 0x02, 0x80, 0x00,
+  0x01, 0x82, 0x05, 0xf0, 0xff, 0xf0, 0x00, 0xfc, 0x00, 0x82, 0x00, 0xf8,
+  0xc1, 0x00, 0x1f, 0x85, 0xc1, 0x00, 0x01, 0x82, 0x06, 0xe0, 0xff, 0xf0,
+  0x00, 0xf8, 0x00, 0x7f, 0x81, 0x00, 0xf8, 0xc1, 0x00, 0x0f, 0x84, 0x00,
+  0xfe, 0xc1, 0x00, 0x01, 0x82, 0x06, 0xe1, 0xff, 0xf8, 0x01, 0xf8, 0x00,
+  0x7f, 0x81, 0x00, 0xf8, 0xc1, 0x00, 0x07, 0x84, 0x00, 0xfc, 0xc1, 0x00,
+  0x01, 0x82, 0x06, 0xc3, 0xff, 0xf8, 0x01, 0xf0, 0x00, 0x3f, 0x81, 0x00,
+  0xf8, 0xc1, 0x00, 0x03, 0x84, 0x03, 0xfc, 0x00, 0x18, 0x01, 0x82, 0x06,
+  0x83, 0xf0, 0xfc, 0x01, 0xf0, 0x00, 0x3f, 0x81, 0x03, 0xf8, 0x01, 0x80,
+  0x03, 0x84, 0x03, 0xf8, 0x00, 0x38, 0x01, 0x82, 0x06, 0x83, 0xf0, 0xfc,
+  0x03, 0xe0, 0x00, 0x1f, 0x81, 0x03, 0xf8, 0x01, 0xc0, 0x01, 0x84, 0x03,
+  0xf8, 0x00, 0x78, 0x01, 0x82, 0x06, 0x03, 0xf0, 0xfc, 0x03, 0xe0, 0x00,
+  0x1f, 0x81, 0x03, 0xf8, 0x01, 0xe0, 0x01, 0x84, 0x03, 0xfc, 0x00, 0xf8,
+  0x01, 0x82, 0x06, 0x03, 0xf0, 0xfc, 0x07, 0xe0, 0x00, 0x0f, 0x81, 0x03,
+  0xf8, 0x01, 0xf0, 0x03, 0x84, 0x03, 0xfc, 0x01, 0xf8, 0x01, 0x82, 0x06,
+  0x03, 0xf0, 0xfc, 0x07, 0xc0, 0x00, 0x0f, 0x81, 0x03, 0xf8, 0x01, 0xf8,
+  0x03, 0x84, 0x03, 0xfe, 0x03, 0xf8, 0x01, 0x81, 0x07, 0xfe, 0x03, 0xf0,
+  0xfc, 0x0f, 0xc0, 0x00, 0x07, 0x81, 0x03, 0xf8, 0x01, 0xfc, 0x07, 0x85,
+  0x02, 0x07, 0xf8, 0x01, 0x81, 0x07, 0xfe, 0x03, 0xf0, 0xfc, 0x0f, 0x80,
+  0x00, 0x07, 0x81, 0x03, 0xf8, 0x01, 0xfe, 0x0f, 0x86, 0x01, 0xf8, 0x01,
+  0x81, 0x07, 0xfc, 0x03, 0xf0, 0xfc, 0x1f, 0x80, 0x00, 0x03, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x04, 0xfc, 0x03, 0xf0, 0xfc,
+  0x1f, 0xc1, 0x00, 0x03, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x04, 0xfc, 0x03, 0xf0, 0xfc, 0x3f, 0xc1, 0x00, 0x03, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x04, 0xf8, 0x03, 0xf9, 0xfc,
+  0x3e, 0xc1, 0x00, 0x03, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x04, 0xf8, 0x01, 0xff, 0xf8, 0x7e, 0xc1, 0x00, 0x01, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x04, 0xf8, 0x01, 0xff, 0xf8,
+  0x7c, 0xc1, 0x00, 0x01, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x07, 0xf8, 0x00, 0xff, 0xf0, 0x7c, 0x03, 0x80, 0x01, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x07, 0xf8, 0x00, 0x7f, 0xe0,
+  0xf8, 0x1f, 0xf0, 0x01, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x07, 0xf8, 0x00, 0x1f, 0x80, 0xf8, 0x3f, 0xf8, 0x01, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x00, 0xf8, 0xc1, 0x04, 0x01,
+  0xf0, 0x7f, 0xfc, 0x01, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x00, 0xf8, 0xc1, 0x04, 0x01, 0xf0, 0x7f, 0xfe, 0x01, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x00, 0xf8, 0xc1, 0x04, 0x03,
+  0xf0, 0xfe, 0xfe, 0x01, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x00, 0xf8, 0xc1, 0x04, 0x03, 0xe0, 0xfc, 0x7f, 0x01, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x00, 0xf8, 0xc1, 0x04, 0x07,
+  0xe0, 0xfc, 0x3f, 0x01, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x00, 0xf8, 0xc1, 0x04, 0x07, 0xc1, 0xfc, 0x3f, 0x01, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x00, 0xf8, 0xc1, 0x04, 0x0f,
+  0xc1, 0xf8, 0x3f, 0x01, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x00, 0xf8, 0xc1, 0x04, 0x0f, 0x81, 0xf8, 0x3f, 0x01, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x00, 0xfc, 0xc1, 0x04, 0x1f,
+  0x81, 0xf8, 0x3f, 0x03, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x00, 0xfc, 0xc1, 0x04, 0x1f, 0x01, 0xf8, 0x3f, 0x03, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x00, 0xfc, 0xc1, 0x04, 0x1f,
+  0x01, 0xfc, 0x3f, 0x03, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x00, 0xfc, 0xc1, 0x04, 0x3e, 0x00, 0xfc, 0x3f, 0x07, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x81, 0x00, 0xfe, 0xc1, 0x04, 0x3e,
+  0x00, 0xfc, 0x3f, 0x07, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x81, 0x00, 0xfe, 0xc1, 0x04, 0x7c, 0x00, 0xfc, 0x7e, 0x07, 0x81, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x82, 0xc1, 0x04, 0x7c, 0x00, 0xff,
+  0xfe, 0x0f, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x82, 0xc1,
+  0x04, 0xf8, 0x00, 0x7f, 0xfc, 0x0f, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01,
+  0xf8, 0x01, 0x82, 0x06, 0x80, 0x00, 0xf8, 0x00, 0x3f, 0xfc, 0x1f, 0x81,
+  0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x82, 0x06, 0xc0, 0x01, 0xf8,
+  0x00, 0x1f, 0xf8, 0x3f, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01,
+  0x82, 0x06, 0xc0, 0x01, 0xf0, 0x00, 0x0f, 0xe0, 0x3f, 0x81, 0x01, 0xf8,
+  0x01, 0x88, 0x01, 0xf8, 0x01, 0x82, 0x02, 0xe0, 0x03, 0xf0, 0xc2, 0x00,
+  0x7f, 0x81, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x82, 0x00, 0xf0,
+  0xc4, 0x82, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x82, 0x00, 0xf8,
+  0xc3, 0x00, 0x01, 0x82, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x82,
+  0x00, 0xfc, 0xc3, 0x00, 0x03, 0x82, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8,
+  0x01, 0x82, 0x00, 0xfe, 0xc3, 0x00, 0x07, 0x82, 0x01, 0xf8, 0x01, 0x88,
+  0x01, 0xf8, 0x01, 0x83, 0xc3, 0x00, 0x0f, 0x82, 0x01, 0xf8, 0x01, 0x88,
+  0x01, 0xf8, 0x01, 0x83, 0x00, 0xc0, 0xc2, 0x00, 0x3f, 0x82, 0x01, 0xf8,
+  0x01, 0x88, 0x01, 0xf8, 0x01, 0x83, 0x00, 0xe0, 0xc2, 0x00, 0x7f, 0x82,
+  0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x83, 0x00, 0xf8, 0xc1, 0x00,
+  0x01, 0x83, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x84, 0xc1, 0x00,
+  0x0f, 0x83, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x84, 0x02, 0xe0,
+  0x00, 0x7f, 0x83, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x8b, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x8b, 0x01, 0xf8, 0x01, 0x88, 0x01,
+  0xf8, 0x01, 0x8b, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x8b, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x8b, 0x01, 0xf8, 0x01, 0x88, 0x01,
+  0xf8, 0x01, 0x8b, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x8b, 0x01,
+  0xf8, 0x01, 0x88, 0x01, 0xf8, 0x01, 0x8b, 0x01, 0xf8, 0x01, 0x88, 0x01,
+  0xf8, 0x01, 0x8b, 0x01, 0xf8, 0x01, 0x88, 0x01, 0xf8, 0x00, 0x8b, 0x01,
+  0xf0, 0x01, 0x88, 0x01, 0xf8, 0x00, 0x8b, 0x01, 0xf0, 0x01, 0x88, 0x02,
+  0xf8, 0x00, 0x3f, 0x8a, 0x01, 0xc0, 0x01, 0x88, 0x00, 0xfc, 0xcd, 0x00,
+  0x03, 0x88, 0x00, 0xfc, 0xcd, 0x00, 0x03, 0x88, 0x00, 0xfe, 0xcd, 0x00,
+  0x07, 0x88, 0x00, 0xfe, 0xcd, 0x00, 0x07, 0x89, 0xcd, 0x00, 0x0f, 0x89,
+  0x00, 0x80, 0xcc, 0x00, 0x1f, 0x89, 0x00, 0xc0, 0xcc, 0x00, 0x3f, 0x89,
+  0x00, 0xe0, 0xcc, 0x00, 0x7f, 0x89, 0x00, 0xf8, 0xcb, 0x00, 0x01, 0x8a,
+  0x00, 0xfe, 0xcb, 0x00, 0x07, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+  0xbf, 0xbf, 0xbf, 0xbf, 0x81
 };
\ No newline at end of file
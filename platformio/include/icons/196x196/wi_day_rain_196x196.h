@@ -1,412 +1,163 @@
-// 196 x 196
+// 196 x 196, run-length encoded
 const unsigned char wi_day_rain_196x196[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x0f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x01,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x01, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x01, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xe0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff,
-  0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x1f, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x1f,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-  0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xf0,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff,
-  0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x80,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x07, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x7f,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xc0, 0x00, 0x00,
-  0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xc0, 0x00,
-  0x00, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xc0,
-  0x00, 0x00, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff,
-  0xc0, 0x00, 0x00, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xe0, 0x03,
-  0xff, 0xc0, 0x00, 0x00, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xe0,
-  0x03, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff,
-  0xe0, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xf0, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x07,
-  0xff, 0xe0, 0x03, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-  0x01, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x00, 0x1f, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfe, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfe, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfc,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-  0xff, 0xc7, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x7f, 0xff, 0x01, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xc0,
-  0x7f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x3f, 0xfe, 0x00, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0x80, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x3f, 0xfc, 0x00, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xfc, 0x00,
-  0x7f, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0xff, 0xfc,
-  0x00, 0x7f, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0x03, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0xff,
-  0xfc, 0x00, 0x7f, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x03,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xf8, 0x00, 0x7f, 0xe0, 0x01, 0xff,
-  0xff, 0xf8, 0x00, 0x7f, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0,
-  0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0x7f, 0xe0, 0x03,
-  0xff, 0xff, 0xf8, 0x00, 0x7f, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xe0, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xe0,
-  0x03, 0xff, 0xff, 0xf0, 0x00, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xf8, 0x00, 0xff,
-  0xc0, 0x03, 0xff, 0xff, 0xf0, 0x00, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xf0, 0x00,
-  0xff, 0xc0, 0x03, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xc0, 0x01, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xf0,
-  0x00, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xe0, 0x01, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x7f,
-  0xf0, 0x01, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x01,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00,
-  0x7f, 0xf0, 0x01, 0xff, 0x80, 0x07, 0xff, 0xff, 0x80, 0x03, 0xff, 0xf8,
-  0x03, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xf8,
-  0x00, 0x7f, 0xe0, 0x01, 0xff, 0x80, 0x0f, 0xff, 0xff, 0x00, 0x03, 0xff,
-  0xfc, 0x07, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff,
+  0xbf, 0xbf, 0xa3, 0x00, 0x81, 0x97, 0xc0, 0x96, 0x02, 0xfe, 0x00, 0x7f,
+  0x95, 0x02, 0xfe, 0x00, 0x7f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02,
+  0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe, 0x00,
+  0x3f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95,
+  0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe,
+  0x00, 0x3f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe, 0x00, 0x3f,
+  0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02,
+  0xfe, 0x00, 0x3f, 0x90, 0x00, 0xfc, 0x83, 0x02, 0xfe, 0x00, 0x3f, 0x83,
+  0x00, 0xbf, 0x8b, 0x01, 0xe0, 0x3f, 0x82, 0x02, 0xfe, 0x00, 0x3f, 0x82,
+  0x01, 0xfc, 0x07, 0x8b, 0x01, 0xc0, 0x1f, 0x82, 0x02, 0xfe, 0x00, 0x7f,
+  0x82, 0x01, 0xf8, 0x03, 0x8b, 0x01, 0xc0, 0x0f, 0x82, 0x02, 0xfe, 0x00,
+  0x7f, 0x82, 0x01, 0xf0, 0x01, 0x8b, 0x01, 0x80, 0x07, 0x83, 0xc0, 0x83,
+  0x01, 0xe0, 0x01, 0x8b, 0x01, 0x80, 0x03, 0x83, 0x00, 0xc1, 0x83, 0x01,
+  0xc0, 0x01, 0x8b, 0x01, 0x80, 0x01, 0x88, 0x01, 0x80, 0x01, 0x8b, 0x01,
+  0x80, 0x00, 0x88, 0xc0, 0x00, 0x01, 0x8b, 0x01, 0x80, 0x00, 0x87, 0x02,
+  0xfe, 0x00, 0x01, 0x8b, 0x01, 0xc0, 0x00, 0x87, 0x02, 0xfc, 0x00, 0x03,
+  0x8b, 0x01, 0xe0, 0x00, 0x87, 0x02, 0xf8, 0x00, 0x07, 0x8b, 0x01, 0xf0,
+  0x00, 0x87, 0x02, 0xf0, 0x00, 0x0f, 0x8b, 0x01, 0xf8, 0x00, 0x87, 0x02,
+  0xf0, 0x00, 0x1f, 0x8b, 0x01, 0xfc, 0x01, 0x87, 0x02, 0xe0, 0x00, 0x3f,
+  0x8b, 0x01, 0xfe, 0x03, 0x87, 0x02, 0xe0, 0x00, 0x7f, 0x8c, 0x00, 0x87,
+  0x87, 0x01, 0xe0, 0x00, 0x96, 0x01, 0xe0, 0x01, 0x92, 0xc0, 0x82, 0x01,
+  0xe0, 0x03, 0x91, 0x02, 0xe0, 0x00, 0x07, 0x81, 0x01, 0xf0, 0x07, 0x91,
+  0xc2, 0x81, 0x01, 0xf8, 0x0f, 0x90, 0x00, 0xf8, 0xc2, 0x03, 0x1f, 0xff,
+  0xfc, 0x1f, 0x90, 0x00, 0xf0, 0xc2, 0x00, 0x07, 0x93, 0x00, 0xc0, 0xc2,
+  0x00, 0x03, 0x93, 0xc4, 0x8f, 0x03, 0xfc, 0x0f, 0xff, 0xfe, 0xc4, 0x00,
+  0x7f, 0x8d, 0x00, 0xfe, 0xc1, 0x01, 0x1f, 0xfc, 0xc4, 0x00, 0x3f, 0x8d,
+  0x00, 0xf0, 0xc1, 0x01, 0x03, 0xf8, 0xc4, 0x00, 0x1f, 0x8d, 0x00, 0xc0,
+  0xc2, 0x00, 0xf0, 0xc4, 0x00, 0x07, 0x8c, 0x00, 0xfe, 0xc6, 0x00, 0x18,
+  0xc1, 0x00, 0x07, 0x8c, 0x00, 0xfc, 0xc5, 0x04, 0x07, 0xff, 0xe0, 0x00,
+  0x03, 0x8c, 0x00, 0xf0, 0xc5, 0x04, 0x1f, 0xff, 0xfc, 0x00, 0x01, 0x8c,
+  0x00, 0xe0, 0xc5, 0x00, 0x7f, 0x81, 0xc1, 0x8c, 0x00, 0x80, 0xc4, 0x00,
+  0x01, 0x82, 0x02, 0x80, 0x00, 0x7f, 0x8b, 0xc5, 0x00, 0x03, 0x82, 0x02,
+  0xe0, 0x00, 0x7f, 0x8a, 0x00, 0xfe, 0xc5, 0x00, 0x07, 0x82, 0x02, 0xf0,
+  0x00, 0x3f, 0x8a, 0x00, 0xfc, 0xc1, 0x01, 0x03, 0xf0, 0xc1, 0x00, 0x0f,
+  0x82, 0x02, 0xf8, 0x00, 0x3f, 0x8a, 0x00, 0xf8, 0xc1, 0x04, 0x7f, 0xff,
+  0x80, 0x00, 0x07, 0x82, 0x02, 0xfc, 0x00, 0x1f, 0x8a, 0x02, 0xf0, 0x00,
+  0x03, 0x81, 0x02, 0xf0, 0x00, 0x03, 0x82, 0x02, 0xfc, 0x00, 0x1f, 0x8a,
+  0x02, 0xe0, 0x00, 0x0f, 0x81, 0x02, 0xfc, 0x00, 0x01, 0x82, 0x02, 0xfe,
+  0x00, 0x0f, 0x8a, 0x02, 0xc0, 0x00, 0x3f, 0x82, 0xc1, 0x83, 0xc0, 0x00,
+  0x0f, 0x8a, 0x02, 0x80, 0x00, 0x7f, 0x82, 0x02, 0x80, 0x00, 0x7f, 0x82,
+  0xc0, 0x00, 0x07, 0x8a, 0x01, 0x80, 0x00, 0x83, 0x02, 0xe0, 0x00, 0x7f,
+  0x82, 0x01, 0x80, 0x07, 0x8a, 0xc0, 0x00, 0x01, 0x83, 0x02, 0xf0, 0x00,
+  0x3f, 0x82, 0x01, 0x80, 0x07, 0x89, 0x02, 0xfe, 0x00, 0x07, 0x83, 0x02,
+  0xf8, 0x00, 0x1f, 0x82, 0x01, 0xc0, 0x07, 0x89, 0x02, 0xfe, 0x00, 0x0f,
+  0x83, 0x02, 0xfc, 0x00, 0x1f, 0x82, 0x01, 0xc0, 0x03, 0x89, 0x02, 0xfc,
+  0x00, 0x0f, 0x83, 0x02, 0xfe, 0x00, 0x0f, 0x82, 0x01, 0xc0, 0x03, 0x89,
+  0x02, 0xfc, 0x00, 0x1f, 0x84, 0xc0, 0x00, 0x0f, 0x82, 0x05, 0xe0, 0x03,
+  0xff, 0xf8, 0x00, 0x01, 0x85, 0x02, 0xf8, 0x00, 0x3f, 0x84, 0xc0, 0x00,
+  0x07, 0x82, 0x03, 0xe0, 0x03, 0xff, 0xe0, 0xc1, 0x85, 0x02, 0xf8, 0x00,
+  0x7f, 0x84, 0x01, 0x80, 0x07, 0x82, 0x03, 0xe0, 0x03, 0xff, 0xe0, 0xc1,
+  0x00, 0x7f, 0x84, 0x02, 0xf0, 0x00, 0x7f, 0x84, 0x01, 0x80, 0x07, 0x82,
+  0x03, 0xe0, 0x03, 0xff, 0xc0, 0xc1, 0x00, 0x3f, 0x84, 0x01, 0xf0, 0x00,
+  0x85, 0x01, 0xc0, 0x03, 0x82, 0x03, 0xe0, 0x03, 0xff, 0xc0, 0xc1, 0x00,
+  0x3f, 0x84, 0x01, 0xf0, 0x00, 0x85, 0x01, 0xe0, 0x03, 0x82, 0x03, 0xe0,
+  0x03, 0xff, 0xc0, 0xc1, 0x00, 0x3f, 0x84, 0x01, 0xe0, 0x01, 0x85, 0x01,
+  0xe0, 0x03, 0x82, 0x03, 0xe0, 0x03, 0xff, 0xc0, 0xc1, 0x00, 0x3f, 0x84,
+  0x01, 0xe0, 0x01, 0x85, 0x01, 0xe0, 0x01, 0x82, 0x03, 0xe0, 0x03, 0xff,
+  0xc0, 0xc1, 0x00, 0x3f, 0x84, 0x01, 0xe0, 0x01, 0x85, 0x02, 0xf0, 0x00,
+  0x0f, 0x81, 0x03, 0xe0, 0x03, 0xff, 0xc0, 0xc1, 0x00, 0x7f, 0x84, 0x01,
+  0x80, 0x03, 0x85, 0x00, 0xf0, 0xc1, 0x05, 0x3f, 0xff, 0xe0, 0x03, 0xff,
+  0xe0, 0xc1, 0x00, 0x7f, 0x83, 0x02, 0xfc, 0x00, 0x03, 0x85, 0x00, 0xf0,
+  0xc1, 0x07, 0x07, 0xff, 0xe0, 0x03, 0xff, 0xf8, 0x00, 0x01, 0x84, 0x02,
+  0xf0, 0x00, 0x03, 0x85, 0x00, 0xf0, 0xc1, 0x03, 0x01, 0xff, 0xc0, 0x03,
+  0x88, 0x02, 0xc0, 0x00, 0x03, 0x85, 0x00, 0xf8, 0xc2, 0x02, 0x7f, 0xc0,
+  0x03, 0x88, 0xc1, 0x00, 0x03, 0x85, 0x00, 0xf8, 0xc2, 0x02, 0x1f, 0xc0,
+  0x03, 0x87, 0x00, 0xfe, 0xc1, 0x00, 0x03, 0x85, 0x00, 0xf8, 0xc2, 0x02,
+  0x0f, 0x80, 0x07, 0x87, 0x00, 0xfc, 0xc1, 0x00, 0x07, 0x85, 0x00, 0xf8,
+  0xc2, 0x02, 0x07, 0x80, 0x07, 0x87, 0x00, 0xf0, 0xc1, 0x00, 0x07, 0x85,
+  0x00, 0xf8, 0xc2, 0x02, 0x03, 0x00, 0x07, 0x87, 0x00, 0xe0, 0xc1, 0x00,
+  0x07, 0x85, 0x00, 0xf8, 0xc4, 0x00, 0x0f, 0x87, 0x00, 0xc0, 0xc1, 0x00,
+  0x07, 0x85, 0x00, 0xfc, 0xc4, 0x00, 0x0f, 0x87, 0x02, 0xc0, 0x00, 0x01,
+  0x88, 0x00, 0xf0, 0xc2, 0x00, 0x0f, 0x87, 0x02, 0x80, 0x00, 0x1f, 0x89,
+  0xc2, 0x00, 0x1f, 0x87, 0xc1, 0x00, 0x7f, 0x89, 0x00, 0xe0, 0xc1, 0x00,
+  0x1f, 0x86, 0x02, 0xfe, 0x00, 0x01, 0x8a, 0x00, 0xf0, 0xc1, 0x00, 0x3f,
+  0x86, 0x02, 0xfe, 0x00, 0x03, 0x8a, 0x00, 0xfc, 0xc1, 0x00, 0x7f, 0x86,
+  0x02, 0xfc, 0x00, 0x0f, 0x8a, 0x00, 0xfe, 0xc1, 0x00, 0x7f, 0x86, 0x02,
+  0xf8, 0x00, 0x1f, 0x8b, 0xc1, 0x87, 0x02, 0xf8, 0x00, 0x3f, 0x8b, 0x01,
+  0x80, 0x01, 0x87, 0x02, 0xf8, 0x00, 0x3f, 0x8b, 0x01, 0xc0, 0x01, 0x87,
+  0x02, 0xf0, 0x00, 0x7f, 0x8b, 0x01, 0xe0, 0x01, 0x87, 0x01, 0xf0, 0x00,
+  0x8c, 0x01, 0xe0, 0x00, 0x87, 0x01, 0xe0, 0x00, 0x8c, 0x01, 0xf0, 0x00,
+  0x87, 0x01, 0xe0, 0x01, 0x8c, 0x01, 0xf0, 0x00, 0x87, 0x01, 0xe0, 0x01,
+  0x8c, 0x02, 0xf8, 0x00, 0x7f, 0x86, 0x01, 0xe0, 0x03, 0x8c, 0x02, 0xf8,
+  0x00, 0x7f, 0x86, 0x01, 0xc0, 0x03, 0x8c, 0x02, 0xfc, 0x00, 0x7f, 0x86,
+  0x01, 0xc0, 0x03, 0x8c, 0x02, 0xfc, 0x00, 0x7f, 0x86, 0x01, 0xc0, 0x07,
+  0x8c, 0x02, 0xfc, 0x00, 0x7f, 0x86, 0x01, 0xc0, 0x07, 0x8c, 0x02, 0xfc,
+  0x00, 0x7f, 0x86, 0x01, 0xc0, 0x07, 0x8c, 0x02, 0xfc, 0x00, 0x7f, 0x86,
+  0x01, 0xc0, 0x07, 0x8c, 0x02, 0xfc, 0x00, 0x3f, 0x86, 0x01, 0xc0, 0x07,
+  0x8c, 0x02, 0xfc, 0x00, 0x3f, 0x86, 0x01, 0xc0, 0x07, 0x83, 0x00, 0xe1,
+  0x81, 0x03, 0xc7, 0xff, 0xfe, 0x1f, 0x81, 0x02, 0xfc, 0x00, 0x3f, 0x86,
+  0x01, 0xc0, 0x07, 0x83, 0x06, 0x80, 0x7f, 0xff, 0x01, 0xff, 0xf8, 0x07,
+  0x81, 0x04, 0xfc, 0x00, 0x7f, 0xc0, 0x7f, 0x84, 0x01, 0xc0, 0x07, 0x83,
+  0x06, 0x80, 0x3f, 0xfe, 0x00, 0xff, 0xf8, 0x03, 0x81, 0x04, 0xfc, 0x00,
+  0x7f, 0x80, 0x3f, 0x84, 0x01, 0xc0, 0x07, 0x83, 0xc0, 0x05, 0x3f, 0xfc,
+  0x00, 0xff, 0xf0, 0x03, 0x81, 0x04, 0xfc, 0x00, 0x7f, 0x80, 0x1f, 0x84,
+  0x01, 0xc0, 0x03, 0x83, 0xc0, 0x05, 0x1f, 0xfc, 0x00, 0x7f, 0xf0, 0x01,
+  0x81, 0x04, 0xfc, 0x00, 0x7f, 0x00, 0x0f, 0x84, 0x01, 0xc0, 0x03, 0x82,
+  0x07, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0xf0, 0x01, 0x81, 0x04, 0xfc,
+  0x00, 0x7f, 0x00, 0x07, 0x84, 0x01, 0xe0, 0x03, 0x82, 0x07, 0xfe, 0x00,
+  0x1f, 0xf8, 0x00, 0x7f, 0xe0, 0x01, 0x81, 0x04, 0xf8, 0x00, 0x7f, 0x00,
+  0x03, 0x84, 0x01, 0xe0, 0x01, 0x82, 0x07, 0xfe, 0x00, 0x3f, 0xf8, 0x00,
+  0x7f, 0xe0, 0x03, 0x81, 0x04, 0xf8, 0x00, 0x7f, 0x00, 0x03, 0x84, 0x01,
+  0xe0, 0x01, 0x82, 0x07, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xe0, 0x03,
+  0x81, 0x04, 0xf0, 0x00, 0xff, 0x80, 0x01, 0x84, 0x01, 0xe0, 0x00, 0x82,
+  0x07, 0xfc, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xc0, 0x03, 0x81, 0x04, 0xf0,
+  0x00, 0xff, 0x80, 0x01, 0x84, 0x01, 0xf0, 0x00, 0x82, 0x07, 0xfc, 0x00,
+  0x3f, 0xf0, 0x00, 0xff, 0xc0, 0x03, 0x81, 0x04, 0xe0, 0x00, 0xff, 0xc0,
+  0x01, 0x84, 0x02, 0xf0, 0x00, 0x7f, 0x81, 0x07, 0xfc, 0x00, 0x7f, 0xf0,
+  0x00, 0xff, 0xc0, 0x07, 0x81, 0x04, 0xe0, 0x01, 0xff, 0xe0, 0x01, 0x84,
+  0x02, 0xf8, 0x00, 0x3f, 0x81, 0x07, 0xf8, 0x00, 0x7f, 0xf0, 0x01, 0xff,
+  0xc0, 0x07, 0x81, 0x04, 0xc0, 0x01, 0xff, 0xf0, 0x01, 0x84, 0x02, 0xf8,
+  0x00, 0x3f, 0x81, 0x07, 0xf8, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0x80, 0x07,
+  0x81, 0x04, 0x80, 0x03, 0xff, 0xf8, 0x03, 0x84, 0x02, 0xfc, 0x00, 0x1f,
+  0x81, 0x07, 0xf8, 0x00, 0x7f, 0xe0, 0x01, 0xff, 0x80, 0x0f, 0x81, 0xc0,
+  0x03, 0x03, 0xff, 0xfc, 0x07, 0x84, 0x02, 0xfc, 0x00, 0x0f, 0x81, 0x0b,
   0xf8, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x80, 0x0f, 0xff, 0xfe, 0x00, 0x07,
-  0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfe, 0x00, 0x03, 0xff,
-  0xff, 0xf0, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x80, 0x0f, 0xff, 0xfc, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfe, 0x00, 0x01,
-  0xff, 0xff, 0xf0, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x00, 0x0f, 0xff, 0xf8,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x00,
-  0x00, 0x7f, 0xff, 0xf0, 0x01, 0xff, 0xc0, 0x03, 0xff, 0x00, 0x1f, 0xff,
-  0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+  0x81, 0x00, 0x9f, 0x84, 0x02, 0xfe, 0x00, 0x03, 0x81, 0x0b, 0xf0, 0x00,
+  0xff, 0xe0, 0x03, 0xff, 0x80, 0x0f, 0xff, 0xfc, 0x00, 0x07, 0x87, 0x02,
+  0xfe, 0x00, 0x01, 0x81, 0x0b, 0xf0, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x00,
+  0x0f, 0xff, 0xf8, 0x00, 0x0f, 0x88, 0xc1, 0x0d, 0x7f, 0xff, 0xf0, 0x01,
+  0xff, 0xc0, 0x03, 0xff, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x1f, 0x88, 0x0f,
   0x80, 0x00, 0x1f, 0xff, 0xf0, 0x01, 0xff, 0xc0, 0x07, 0xff, 0x00, 0x1f,
-  0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xc0, 0x00, 0x03, 0xff, 0xe0, 0x01, 0xff, 0xc0, 0x07, 0xff, 0x00,
-  0x1f, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xe0, 0x01, 0xff, 0x80, 0x07, 0xfe,
-  0x00, 0x1f, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xe0, 0x03, 0xff, 0x80, 0x07,
-  0xfe, 0x00, 0x3f, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xe0, 0x03, 0xff, 0x80,
-  0x0f, 0xfe, 0x00, 0x3f, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xc0, 0x03, 0xff,
-  0x80, 0x0f, 0xfc, 0x00, 0x3f, 0x80, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xc0, 0x03,
-  0xff, 0x00, 0x0f, 0xfc, 0x00, 0x7f, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xc0,
-  0x07, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x7f, 0x80, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f,
-  0x80, 0x07, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x3f, 0x80, 0x07, 0xff, 0x00, 0x1f, 0xf8, 0x00, 0x7f, 0x80, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x3f, 0x80, 0x07, 0xfe, 0x00, 0x1f, 0xf8, 0x00, 0xff, 0x80, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x3f, 0x80, 0x0f, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0x80,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x3f, 0x00, 0x0f, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0xff,
-  0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x3f, 0xf0, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x3f, 0xf0,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x7f,
-  0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xfc, 0x00,
-  0x7f, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xf8,
-  0x00, 0x7f, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f,
-  0xf8, 0x00, 0x7f, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xf8, 0x00, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x3f, 0xf8, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x3f, 0xf0, 0x00, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0xc0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0x80, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xe0, 0x03, 0xff, 0xc0,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xe0, 0x03, 0xff,
-  0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xc0, 0x03,
-  0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xc0,
-  0x03, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff,
-  0xc0, 0x07, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0
+  0xff, 0x80, 0x00, 0x1f, 0x88, 0x0c, 0xc0, 0x00, 0x03, 0xff, 0xe0, 0x01,
+  0xff, 0xc0, 0x07, 0xff, 0x00, 0x1f, 0xf8, 0xc1, 0x00, 0x3f, 0x88, 0x00,
+  0xe0, 0xc1, 0x09, 0x3f, 0xe0, 0x01, 0xff, 0x80, 0x07, 0xfe, 0x00, 0x1f,
+  0x80, 0xc1, 0x00, 0x7f, 0x88, 0x00, 0xf0, 0xc1, 0x09, 0x3f, 0xe0, 0x03,
+  0xff, 0x80, 0x07, 0xfe, 0x00, 0x3f, 0x80, 0xc1, 0x89, 0x00, 0xf8, 0xc1,
+  0x0b, 0x3f, 0xe0, 0x03, 0xff, 0x80, 0x0f, 0xfe, 0x00, 0x3f, 0x80, 0x00,
+  0x01, 0x89, 0x00, 0xfc, 0xc1, 0x0b, 0x3f, 0xc0, 0x03, 0xff, 0x80, 0x0f,
+  0xfc, 0x00, 0x3f, 0x80, 0x00, 0x03, 0x89, 0x00, 0xfe, 0xc1, 0x0b, 0x3f,
+  0xc0, 0x03, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x7f, 0x80, 0x00, 0x0f, 0x8a,
+  0x0d, 0x80, 0x00, 0x3f, 0xc0, 0x07, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x7f,
+  0x80, 0x00, 0x1f, 0x8a, 0x0d, 0xc0, 0x00, 0x3f, 0x80, 0x07, 0xff, 0x00,
+  0x1f, 0xfc, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0x8a, 0x0c, 0xf0, 0x00, 0x3f,
+  0x80, 0x07, 0xff, 0x00, 0x1f, 0xf8, 0x00, 0x7f, 0x80, 0x00, 0x8b, 0x0c,
+  0xfc, 0x00, 0x3f, 0x80, 0x07, 0xfe, 0x00, 0x1f, 0xf8, 0x00, 0xff, 0x80,
+  0x07, 0x8c, 0x0b, 0x80, 0x3f, 0x80, 0x0f, 0xfe, 0x00, 0x3f, 0xf8, 0x00,
+  0xff, 0x80, 0x1f, 0x8c, 0x0a, 0xfc, 0x3f, 0x00, 0x0f, 0xfe, 0x00, 0x3f,
+  0xf8, 0x00, 0xff, 0xc3, 0x8f, 0xc0, 0x05, 0x0f, 0xfc, 0x00, 0x3f, 0xf0,
+  0x00, 0x91, 0xc0, 0x05, 0x1f, 0xfc, 0x00, 0x3f, 0xf0, 0x01, 0x91, 0xc0,
+  0x05, 0x1f, 0xfc, 0x00, 0x7f, 0xf0, 0x01, 0x90, 0x07, 0xfe, 0x00, 0x1f,
+  0xfc, 0x00, 0x7f, 0xf0, 0x01, 0x90, 0x07, 0xfe, 0x00, 0x1f, 0xf8, 0x00,
+  0x7f, 0xe0, 0x01, 0x90, 0x07, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0x7f, 0xe0,
+  0x03, 0x90, 0x07, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xe0, 0x03, 0x90,
+  0x07, 0xfc, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xc0, 0x03, 0x90, 0x07, 0xfc,
+  0x00, 0x3f, 0xf0, 0x00, 0xff, 0xc0, 0x07, 0x90, 0x07, 0xfc, 0x00, 0x7f,
+  0xf0, 0x01, 0xff, 0xc0, 0x07, 0x90, 0x07, 0xf8, 0x00, 0x7f, 0xf0, 0x01,
+  0xff, 0xc0, 0x07, 0x90, 0x07, 0xf8, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0x80,
+  0x07, 0x90, 0x07, 0xf8, 0x00, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x0f, 0x90,
+  0x07, 0xf8, 0x00, 0xff, 0xe0, 0x03, 0xff, 0xc0, 0x0f, 0x90, 0x07, 0xfc,
+  0x00, 0xff, 0xe0, 0x03, 0xff, 0xc0, 0x0f, 0x90, 0x07, 0xfc, 0x01, 0xff,
+  0xc0, 0x03, 0xff, 0xc0, 0x1f, 0x90, 0x07, 0xfe, 0x01, 0xff, 0xc0, 0x03,
+  0xff, 0xe0, 0x3f, 0x91, 0x05, 0x87, 0xff, 0xc0, 0x07, 0xff, 0xfc, 0x94,
+  0x01, 0xc0, 0x07, 0x96, 0x01, 0x80, 0x07, 0x96, 0x01, 0x80, 0x07, 0x96,
+  0x01, 0x80, 0x0f, 0x96, 0x01, 0x80, 0x0f, 0x96, 0xc0, 0x00, 0x0f, 0x96,
+  0xc0, 0x00, 0x1f, 0x96, 0xc0, 0x00, 0x1f, 0x96, 0xc0, 0x00, 0x1f, 0x95,
+  0x02, 0xfe, 0x00, 0x1f, 0x95, 0x02, 0xfe, 0x00, 0x3f, 0x95, 0x02, 0xfe,
+  0x00, 0x3f, 0x95, 0x02, 0xfc, 0x00, 0x3f, 0x95, 0x02, 0xfc, 0x00, 0x3f,
+  0x95, 0x02, 0xfc, 0x00, 0x7f, 0x95, 0x02, 0xfc, 0x00, 0x7f, 0x95, 0x02,
+  0xfe, 0x00, 0x7f, 0x95, 0x01, 0xfe, 0x00, 0x97, 0x00, 0x01, 0x97, 0x00,
+  0xc3, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x86
 };
\ No newline at end of file